@@ -494,6 +494,14 @@ Amr::InitAmr ()
     loadbalance_with_workestimates = 0;
     pp.query("loadbalance_with_workestimates", loadbalance_with_workestimates);
 
+    derive_cache = 0;
+    pp.query("derive_cache", derive_cache);
+
+    skip_regrid_if_covered = 0;
+    pp.query("skip_regrid_if_covered", skip_regrid_if_covered);
+    num_regrid_checks = 0;
+    num_regrid_skips = 0;
+
     loadbalance_level0_int = 2;
     pp.query("loadbalance_level0_int", loadbalance_level0_int);
 
@@ -740,6 +748,11 @@ Amr::deleteDeriveSmallPlotVar (const std::string& name)
 
 Amr::~Amr ()
 {
+    if (verbose > 0 && num_regrid_checks > 0) {
+        amrex::Print() << "Amr: skipped " << num_regrid_skips << " of " << num_regrid_checks
+                       << " regrids because the tags were still covered by the fine grids\n";
+    }
+
     levelbld->variableCleanUp();
 
     Amr::Finalize();
@@ -1355,6 +1368,7 @@ Amr::FinalizeInit (Real              strt_time,
     for(int lev(0); lev <= finest_level; ++lev) {
       amr_level[lev]->post_init(stop_time);
     }
+    clearDeriveCaches();
 
     if (ParallelDescriptor::IOProcessor())
     {
@@ -1589,6 +1603,7 @@ Amr::restart (const std::string& filename)
        for (int lev = 0; lev <= finest_level; lev++) {
            amr_level[lev]->post_restart();
        }
+       clearDeriveCaches();
 
     } else {
 
@@ -1657,6 +1672,7 @@ Amr::restart (const std::string& filename)
        for (int lev = 0; lev <= new_finest_level; lev++) {
            amr_level[lev]->post_restart();
        }
+       clearDeriveCaches();
     }
 
     // Old checkpoints do not store isPeriodic.
@@ -1945,7 +1961,20 @@ Amr::timeStep (int  level,
         {
             const int old_finest = finest_level;
 
-            if (okToRegrid(i))
+            bool do_regrid = okToRegrid(i);
+            if (do_regrid && skip_regrid_if_covered && tagsCoveredByFineGrids(i,time))
+            {
+                if (verbose > 0) {
+                    amrex::Print() << "Skipping regrid at level lbase = " << i
+                                   << ": all tags are covered by the fine grids\n";
+                }
+                for (int k(i); k <= finest_level; ++k) {
+                    level_count[k] = 0;
+                }
+                do_regrid = false;
+            }
+
+            if (do_regrid)
             {
                 regrid(i,time);
 
@@ -2012,6 +2041,7 @@ Amr::timeStep (int  level,
                        << "ADVANCE with dt = " << dt_level[level] << "\n";
     }
 
+    clearDeriveCaches();
     Real dt_new = amr_level[level]->advance(time,dt_level[level],iteration,niter);
     BL_PROFILE_REGION_STOP("amr_level.advance");
 
@@ -2069,6 +2099,7 @@ Amr::timeStep (int  level,
     }
 
     amr_level[level]->post_timestep(iteration);
+    clearDeriveCaches();
 
     // Set this back to negative so we know whether we are in fact in this routine
     which_level_being_advanced = -1;
@@ -2617,7 +2648,11 @@ Amr::regrid (int  lbase,
             new_dmap[lev] = makeLoadBalanceDistributionMap(lev, time, new_grid_places[lev]);
         }
         else if (new_dmap[lev].empty()) {
-            new_dmap[lev].define(new_grid_places[lev]);
+            if (use_incremental_regrid && !initial && amr_level[lev]) {
+                new_dmap[lev] = MakeIncrementalDistributionMap(lev, new_grid_places[lev]);
+            } else {
+                new_dmap[lev].define(new_grid_places[lev]);
+            }
         }
 
         AmrLevel* a = (*levelbld)(*this,lev,Geom(lev),new_grid_places[lev],
@@ -2667,6 +2702,7 @@ Amr::regrid (int  lbase,
     for(int lev(0); lev <= new_finest; ++lev) {
         amr_level[lev]->post_regrid(lbase,new_finest);
     }
+    clearDeriveCaches();
 
     //
     // Report creation of new grids.
@@ -2766,6 +2802,7 @@ Amr::LoadBalanceLevel0 (Real time)
     const auto& dm = makeLoadBalanceDistributionMap(0, time, boxArray(0));
     InstallNewDistributionMap(0, dm);
     amr_level[0]->post_regrid(0,0);
+    clearDeriveCaches();
 }
 
 void
@@ -3272,6 +3309,70 @@ Amr::okToRegrid(int level) noexcept
         return level_count[level] >= regrid_int[level] && amr_level[level]->okToRegrid();
 }
 
+void
+Amr::clearDeriveCaches ()
+{
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        if (amr_level[lev]) {
+            amr_level[lev]->clearDeriveCache();
+        }
+    }
+}
+
+bool
+Amr::tagsCoveredByFineGrids (int lbase, Real time)
+{
+    BL_PROFILE("Amr::tagsCoveredByFineGrids()");
+
+    ++num_regrid_checks;
+
+    bool covered = true;
+    const int lev_top = std::min(finest_level, max_level-1);
+    for (int lev = lbase; lev <= lev_top && covered; ++lev)
+    {
+        if (useFixedCoarseGrids() && lev < useFixedUpToLevel()) {
+            continue;
+        }
+
+        TagBoxArray tags(grids[lev],dmap[lev]);
+        ErrorEst(lev, tags, time, 0);
+
+        if (lev == finest_level) {
+            // Any tag here would make a new level.
+            covered = !tags.hasTags(Geom(lev).Domain());
+        } else {
+            // The fine grids at lev+1 and their periodic images, as seen from lev.
+            const Geometry& lev_geom = Geom(lev);
+            Box region = lev_geom.Domain();
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                if (lev_geom.isPeriodic(idim)) {
+                    region.grow(idim, n_error_buf[lev][idim]);
+                }
+            }
+            BoxArray fine_ba = amrex::coarsen(grids[lev+1], ref_ratio[lev]);
+            if (lev_geom.isAnyPeriodic()) {
+                BoxList bl(fine_ba);
+                for (const auto& iv : lev_geom.periodicity().shiftIntVect()) {
+                    if (iv == IntVect::TheZeroVector()) continue;
+                    for (int i = 0, N = fine_ba.size(); i < N; ++i) {
+                        const Box& sb = fine_ba[i] + iv;
+                        if (sb.intersects(region)) {
+                            bl.push_back(sb);
+                        }
+                    }
+                }
+                fine_ba = BoxArray(std::move(bl));
+            }
+            covered = !tags.hasTagsOutside(fine_ba, n_error_buf[lev], region);
+        }
+    }
+
+    if (covered) {
+        ++num_regrid_skips;
+    }
+    return covered;
+}
+
 Real
 Amr::computeOptimalSubcycling(int n, int* best, Real* dt_max, Real* est_work, int* cycle_max)
 {
@@ -15,6 +15,7 @@
 #include <AMReX_EB2.H>
 #endif
 
+#include <algorithm>
 #include <sstream>
 #include <memory>
 #include <limits>
@@ -1612,6 +1613,29 @@ AmrLevel::derive (const std::string& name, Real time, int ngrow)
 
     std::unique_ptr<MultiFab> mf;
 
+    const bool use_cache = parent && parent->useDeriveCache();
+    if (use_cache)
+    {
+        // Any entry with at least ngrow ghost cells will do.  Entries
+        // computed before the state last changed are dropped.
+        const Long version = stateVersion();
+        auto it = m_derive_cache.lower_bound(std::make_tuple(name,time,ngrow));
+        while (it != m_derive_cache.end() && std::get<0>(it->first) == name
+               && std::get<1>(it->first) == time)
+        {
+            if (it->second.version != version) {
+                it = m_derive_cache.erase(it);
+                continue;
+            }
+            const MultiFab& cached = *it->second.mf;
+            if (cached.DistributionMap() != dmap) break;
+            mf = std::make_unique<MultiFab>(cached.boxArray(), dmap, cached.nComp(), ngrow,
+                                            MFInfo(), *m_factory);
+            MultiFab::Copy(*mf, cached, 0, 0, cached.nComp(), ngrow);
+            return mf;
+        }
+    }
+
     int index, scomp, ncomp;
 
     if (isStateVariable(name, index, scomp))
@@ -1718,9 +1742,33 @@ AmrLevel::derive (const std::string& name, Real time, int ngrow)
         amrex::Error(msg.c_str());
     }
 
+    if (use_cache)
+    {
+        // Taken after the FillPatch calls above, which may access the state.
+        auto& cached = m_derive_cache[std::make_tuple(name,time,ngrow)];
+        cached.version = stateVersion();
+        cached.mf = std::make_unique<MultiFab>(mf->boxArray(), dmap, mf->nComp(), ngrow,
+                                               MFInfo(), *m_factory);
+        MultiFab::Copy(*cached.mf, *mf, 0, 0, mf->nComp(), ngrow);
+    }
+
     return mf;
 }
 
+Long
+AmrLevel::stateVersion () const
+{
+    Long version = 0;
+    for (int lev = 0; lev <= level; ++lev)
+    {
+        const AmrLevel& amrlev = (lev == level) ? *this : parent->getLevel(lev);
+        for (auto const& sd : amrlev.state) {
+            version = std::max(version, sd.version());
+        }
+    }
+    return version;
+}
+
 void
 AmrLevel::derive (const std::string& name, Real time, MultiFab& mf, int dcomp)
 {
@@ -1730,6 +1778,23 @@ AmrLevel::derive (const std::string& name, Real time, MultiFab& mf, int dcomp)
 
     int index, scomp, ncomp;
 
+    if (parent && parent->useDeriveCache() && mf.DistributionMap() == dmap)
+    {
+        // Use the cached data if the result would be on the same BoxArray.
+        BoxArray dstBA;
+        if (isStateVariable(name,index,scomp)) {
+            dstBA = state[index].boxArray();
+        } else if (const DeriveRec* rec = derive_lst.get(name)) {
+            rec->getRange(0,index,scomp,ncomp);
+            dstBA = amrex::convert(state[index].boxArray(), rec->deriveType());
+        }
+        if (dstBA == mf.boxArray()) {
+            auto derived = AmrLevel::derive(name,time,ngrow);
+            MultiFab::Copy(mf, *derived, 0, dcomp, derived->nComp(), ngrow);
+            return;
+        }
+    }
+
     if (isStateVariable(name,index,scomp))
     {
         FillPatch(*this,mf,ngrow,time,index,scomp,1,dcomp);
@@ -2113,6 +2178,244 @@ AmrLevel::FillPatch (AmrLevel& amrlevel,
     MultiFab::Copy(leveldata, mf_fillpatched, 0, dcomp, ncomp, boxGrow);
 }
 
+namespace {
+
+// Components [gcomp,gcomp+ncomp) of a MultiFab holding several state
+// types are components [scomp,scomp+ncomp) of state data sd.
+struct StatePiece
+{
+    StateData* sd;
+    int scomp;
+    int gcomp;
+    int ncomp;
+};
+
+class MultiStatePhysBCFunct
+{
+public:
+    MultiStatePhysBCFunct (Vector<StatePiece> const& pieces, const Geometry& geom)
+        : m_pieces(pieces), m_geom(geom) {}
+
+    void operator() (MultiFab& mf, int dcomp, int ncomp, IntVect const& nghost,
+                     Real time, int bccomp)
+    {
+        for (auto const& p : m_pieces) {
+            const int lo = std::max(bccomp, p.gcomp);
+            const int hi = std::min(bccomp+ncomp, p.gcomp+p.ncomp);
+            if (lo < hi) {
+                StateDataPhysBCFunct physbcf(*p.sd, p.scomp+lo-p.gcomp, m_geom);
+                physbcf(mf, dcomp+lo-bccomp, hi-lo, nghost, time, p.scomp+lo-p.gcomp);
+            }
+        }
+    }
+
+private:
+    Vector<StatePiece> const& m_pieces;
+    const Geometry& m_geom;
+};
+
+// Interpolate the state data in time into the valid region of mf.  If mf
+// is not on the grids of the state data, it is filled with ParallelCopy,
+// periodic images included.
+void
+StateDataAtTime (MultiFab& mf, int dcomp, StateData& sd, int scomp, int ncomp, Real time,
+                 const Periodicity& period)
+{
+    Vector<MultiFab*> smf;
+    Vector<Real> stime;
+    sd.getData(smf,stime,time);
+
+    const bool same_grids = mf.boxArray() == smf[0]->boxArray() &&
+                            mf.DistributionMap() == smf[0]->DistributionMap();
+    auto copy = [&] (MultiFab& dst, int dc, const MultiFab& src)
+    {
+        if (same_grids) {
+            MultiFab::Copy(dst, src, scomp, dc, ncomp, 0);
+        } else {
+            dst.ParallelCopy(src, scomp, dc, ncomp, IntVect(0), IntVect(0), period);
+        }
+    };
+
+    if (smf.size() == 1 || time == stime[0]) {
+        copy(mf, dcomp, *smf[0]);
+    } else if (time == stime[1]) {
+        copy(mf, dcomp, *smf[1]);
+    } else if (! amrex::almostEqual(stime[0],stime[1])) {
+        const Real alpha = (stime[1]-time)/(stime[1]-stime[0]);
+        const Real beta  = (time-stime[0])/(stime[1]-stime[0]);
+        if (same_grids) {
+            MultiFab::LinComb(mf, alpha, *smf[0], scomp, beta, *smf[1], scomp, dcomp, ncomp, 0);
+        } else {
+            MultiFab tmp(mf.boxArray(), mf.DistributionMap(), ncomp, 0);
+            copy(mf, dcomp, *smf[0]);
+            copy(tmp, 0, *smf[1]);
+            MultiFab::LinComb(mf, alpha, mf, dcomp, beta, tmp, 0, dcomp, ncomp, 0);
+        }
+    } else {
+        copy(mf, dcomp, *smf[0]);
+    }
+}
+
+}
+
+void
+AmrLevel::FillPatch (AmrLevel& amrlevel,
+                     const Vector<MultiFab*>& leveldata,
+                     int       boxGrow,
+                     Real      time,
+                     const Vector<int>& index,
+                     const Vector<int>& scomp,
+                     const Vector<int>& ncomp,
+                     const Vector<int>& dcomp)
+{
+    BL_PROFILE("AmrLevel::FillPatch(multi)");
+
+    const int nfills = leveldata.size();
+    AMREX_ALWAYS_ASSERT(static_cast<int>(index.size()) == nfills &&
+                        static_cast<int>(scomp.size()) == nfills &&
+                        static_cast<int>(ncomp.size()) == nfills &&
+                        static_cast<int>(dcomp.size()) == nfills);
+
+    const int level = amrlevel.level;
+
+    struct Group
+    {
+        IndexType typ;
+        InterpBase* interp;
+        Vector<StatePiece> fine;
+        Vector<StatePiece> crse;
+        Vector<int> idx;
+        Vector<std::pair<int,int> > dest;  // (fill, dcomp) of each piece
+        Vector<BCRec> bcs;
+        int ncomp = 0;
+    };
+    Vector<Group> groups;
+
+    for (int ifill = 0; ifill < nfills; ++ifill)
+    {
+        BL_ASSERT(dcomp[ifill]+ncomp[ifill] <= leveldata[ifill]->nComp());
+        BL_ASSERT(boxGrow <= leveldata[ifill]->nGrow());
+
+        const int idx = index[ifill];
+        const StateDescriptor& desc = AmrLevel::desc_lst[idx];
+        const IndexType& boxType = leveldata[ifill]->ixType();
+        const auto& range = desc.sameInterps(scomp[ifill],ncomp[ifill]);
+
+        bool nested = true;
+        if (level > 1) {
+            for (auto const& r : range) {
+                nested = nested && amrex::ProperlyNested(amrlevel.crse_ratio,
+                                                         amrlevel.parent->blockingFactor(level),
+                                                         boxGrow, boxType, desc.interp(r.first));
+            }
+        }
+        if (!nested) {
+            // Needs data from more than one coarser level
+            FillPatch(amrlevel, *leveldata[ifill], boxGrow, time, idx,
+                      scomp[ifill], ncomp[ifill], dcomp[ifill]);
+            continue;
+        }
+
+        for (int i = 0, DComp = dcomp[ifill]; i < static_cast<int>(range.size()); ++i)
+        {
+            const int SComp = range[i].first;
+            const int NComp = range[i].second;
+            InterpBase* interp = desc.interp(SComp);
+
+            auto it = std::find_if(groups.begin(), groups.end(), [&] (Group const& g)
+                                   { return g.typ == boxType && g.interp == interp; });
+            if (it == groups.end()) {
+                groups.emplace_back();
+                it = groups.end()-1;
+                it->typ = boxType;
+                it->interp = interp;
+            }
+
+            it->fine.push_back({&amrlevel.state[idx], SComp, it->ncomp, NComp});
+            if (level > 0) {
+                AmrLevel& crse_level = amrlevel.parent->getLevel(level-1);
+                it->crse.push_back({&crse_level.state[idx], SComp, it->ncomp, NComp});
+            }
+            it->idx.push_back(idx);
+            it->dest.emplace_back(ifill, DComp);
+            it->bcs.insert(it->bcs.end(), desc.getBCs().begin()+SComp,
+                           desc.getBCs().begin()+SComp+NComp);
+            it->ncomp += NComp;
+            DComp += NComp;
+        }
+    }
+
+    const Geometry& geom = amrlevel.Geom();
+
+    for (auto& g : groups)
+    {
+        const MultiFab& sample = amrlevel.state[g.idx[0]].newData();
+        MultiFab fmf(sample.boxArray(), sample.DistributionMap(), g.ncomp, boxGrow,
+                     MFInfo(), amrlevel.Factory());
+        fmf.setDomainBndry(std::numeric_limits<Real>::quiet_NaN(), geom);
+
+        for (auto const& p : g.fine) {
+            StateDataAtTime(fmf, p.gcomp, *p.sd, p.scomp, p.ncomp, time, geom.periodicity());
+        }
+
+        MultiStatePhysBCFunct physbcf_fine(g.fine, geom);
+
+        // The coarse data are only needed where the ghost cells of fmf are
+        // not covered by fine data: the coarse patch of FillPatchTwoLevels.
+        const FabArrayBase::FPinfo* fpc = nullptr;
+        if (level > 0 && boxGrow > 0)
+        {
+            AmrLevel& crse_level = amrlevel.parent->getLevel(level-1);
+#ifdef AMREX_USE_EB
+            EB2::IndexSpace const* index_space = EB2::TopIndexSpaceIfPresent();
+#else
+            EB2::IndexSpace const* index_space = nullptr;
+#endif
+            fpc = &FabArrayBase::TheFPinfo(fmf, fmf, fmf.nGrowVect(),
+                                           g.interp->BoxCoarsener(crse_level.fineRatio()),
+                                           geom, crse_level.Geom(), index_space);
+            if (fpc->ba_crse_patch.empty()) fpc = nullptr;
+        }
+
+        if (fpc == nullptr)
+        {
+            amrex::FillPatchSingleLevel(fmf, time, {&fmf}, {time}, 0, 0, g.ncomp,
+                                        geom, physbcf_fine, 0);
+        }
+        else
+        {
+            AmrLevel& crse_level = amrlevel.parent->getLevel(level-1);
+            const Geometry& geom_crse = crse_level.Geom();
+            MultiFab cmf(fpc->ba_crse_patch, fpc->dm_patch, g.ncomp, 0);
+
+            for (auto const& p : g.crse) {
+                StateDataAtTime(cmf, p.gcomp, *p.sd, p.scomp, p.ncomp, time,
+                                geom_crse.periodicity());
+            }
+
+            MultiStatePhysBCFunct physbcf_crse(g.crse, geom_crse);
+
+            amrex::FillPatchTwoLevels(fmf, time,
+                                      {&cmf}, {time},
+                                      {&fmf}, {time},
+                                      0, 0, g.ncomp,
+                                      geom_crse, geom,
+                                      physbcf_crse, 0,
+                                      physbcf_fine, 0,
+                                      crse_level.fineRatio(),
+                                      g.interp, g.bcs, 0);
+        }
+
+        for (int i = 0, N = g.fine.size(); i < N; ++i)
+        {
+            auto const& p = g.fine[i];
+            amrlevel.set_preferred_boundary_values(fmf, g.idx[i], p.scomp, p.gcomp, p.ncomp, time);
+            MultiFab::Copy(*leveldata[g.dest[i].first], fmf, p.gcomp, g.dest[i].second,
+                           p.ncomp, boxGrow);
+        }
+    }
+}
+
 void
 AmrLevel::FillPatchAdd (AmrLevel& amrlevel,
                         MultiFab& leveldata,
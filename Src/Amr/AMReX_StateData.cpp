@@ -26,6 +26,7 @@ static constexpr int MFOLDDATA = 1;
 
 Vector<std::string> StateData::fabArrayHeaderNames;
 std::map<std::string, Vector<char> > *StateData::faHeaderMap;
+std::atomic<Long> StateData::s_version{0};
 
 
 StateData::StateData ()
@@ -57,7 +58,8 @@ StateData::StateData (StateData&& rhs) noexcept
       old_time(rhs.old_time),
       new_data(std::move(rhs.new_data)),
       old_data(std::move(rhs.old_data)),
-      arena(rhs.arena)
+      arena(rhs.arena),
+      m_version(rhs.m_version)
 {
 }
 
@@ -84,6 +86,7 @@ StateData::operator= (StateData const& rhs)
     } else {
         old_data.reset();
     }
+    touch();
 }
 
 void
@@ -130,6 +133,7 @@ StateData::define (const Box&             p_domain,
                                           MFInfo().SetTag("StateData").SetArena(arena),
                                           *m_factory);
     old_data.reset();
+    touch();
 }
 
 void
@@ -146,6 +150,7 @@ StateData::copyOld (const StateData& state)
     MultiFab::Copy(*old_data, state.oldData(), 0, 0, nc, ng);
 
     old_time = state.old_time;
+    touch();
 }
 
 void
@@ -162,6 +167,7 @@ StateData::copyNew (const StateData& state)
     MultiFab::Copy(*new_data, state.newData(), 0, 0, nc, ng);
 
     new_time = state.new_time;
+    touch();
 }
 
 void
@@ -170,6 +176,7 @@ StateData::reset ()
     new_time = old_time;
     old_time.start = old_time.stop = INVALID_TIME;
     std::swap(old_data, new_data);
+    touch();
 }
 
 void
@@ -229,6 +236,7 @@ StateData::restartDoit (std::istream& is, const std::string& chkfile)
                                               MFInfo().SetTag("StateData").SetArena(arena),
                                               *m_factory);
     }
+    touch();
     //
     // If no data is written then we just allocate the MF instead of reading it in.
     // This assumes that the application will do something with it.
@@ -294,6 +302,7 @@ StateData::restart (const StateDescriptor& d,
                                           MFInfo().SetTag("StateData").SetArena(arena),
                                           *m_factory);
     new_data->setVal(0._rt);
+    touch();
 }
 
 StateData::~StateData()
@@ -310,6 +319,7 @@ StateData::allocOldData ()
                                               MFInfo().SetTag("StateData").SetArena(arena),
                                               *m_factory);
     }
+    touch();
 }
 
 BCRec
@@ -331,6 +341,7 @@ StateData::setOldTimeLevel (Real time)
     {
         amrex::Error("StateData::setOldTimeLevel called with Interval");
     }
+    touch();
 }
 
 void
@@ -344,6 +355,7 @@ StateData::setNewTimeLevel (Real time)
     {
         amrex::Error("StateData::setNewTimeLevel called with Interval");
     }
+    touch();
 }
 
 void
@@ -360,6 +372,7 @@ StateData::syncNewTimeLevel (Real time)
         {
             new_time.stop = time;
         }
+        touch();
     }
 }
 
@@ -380,6 +393,7 @@ StateData::setTimeLevel (Real time,
         old_time.start = time-dt_old;
         old_time.stop  = time;
     }
+    touch();
 }
 
 void
@@ -397,12 +411,14 @@ StateData::swapTimeLevels (Real dt)
         new_time.stop += dt;
     }
     std::swap(old_data, new_data);
+    touch();
 }
 
 void
 StateData::replaceOldData (MultiFab&& mf)
 {
     old_data = std::make_unique<MultiFab>(std::move(mf));
+    touch();
 }
 
 // This version does NOT delete the replaced data.
@@ -411,12 +427,15 @@ void
 StateData::replaceOldData (StateData& s)
 {
     MultiFab::Swap(*old_data, *s.old_data, 0, 0, old_data->nComp(), old_data->nGrow());
+    touch();
+    s.touch();
 }
 
 void
 StateData::replaceNewData (MultiFab&& mf)
 {
     new_data = std::make_unique<MultiFab>(std::move(mf));
+    touch();
 }
 
 // This version does NOT delete the replaced data.
@@ -425,6 +444,8 @@ void
 StateData::replaceNewData (StateData& s)
 {
     MultiFab::Swap(*new_data, *s.new_data, 0, 0, new_data->nComp(), new_data->nGrow());
+    touch();
+    s.touch();
 }
 
 void
@@ -6,6 +6,8 @@
 #include <AMReX_ParallelDescriptor.H>
 #include <AMReX_Print.H>
 
+#include <algorithm>
+
 namespace amrex {
 
 AmrMesh::AmrMesh ()
@@ -105,6 +107,8 @@ AmrMesh::InitAmrMesh (int max_level_in, const Vector<int>& n_cell_in,
 
     pp.query("n_proper",n_proper);
     pp.query("grid_eff",grid_eff);
+    pp.query("use_distributed_clustering",use_distributed_clustering);
+    pp.query("use_incremental_regrid",use_incremental_regrid);
     int cnt = pp.countval("n_error_buf");
     if (cnt > 0) {
         Vector<int> neb;
@@ -581,6 +585,8 @@ AmrMesh::MakeNewGrids (int lbase, Real time, int& new_finest, Vector<BoxArray>&
     //
     new_finest = lbase;
 
+    Vector<int> nretained(max_level+1, 0);
+
     for (int levc = max_crse; levc >= lbase; levc--)
     {
         int levf = levc+1;
@@ -671,14 +677,36 @@ AmrMesh::MakeNewGrids (int lbase, Real time, int& new_finest, Vector<BoxArray>&
         //
         tags.setVal(p_n_comp_ba[levc],TagBox::CLEAR);
         p_n_comp_ba[levc].clear();
+
+        // The clustering below consumes p_n_ba[levc]
+        const bool incremental = use_incremental_regrid && levf <= finest_level;
+        BoxArray p_n_incr;
+        if (incremental) {
+            p_n_incr = p_n_ba[levc];
+        }
         //
         // Create initial cluster containing all tagged points.
         //
         Gpu::PinnedVector<IntVect> tagvec;
-        tags.collate(tagvec);
+        BoxList dist_bx;
+        bool has_tags;
+        if (use_distributed_clustering)
+        {
+            IntVect tile_size;
+            for (int n=0; n<AMREX_SPACEDIM; n++) {
+                tile_size[n] = std::max(1, max_grid_size[levf][n]/(bf_lev[levc][n]*ref_ratio[levc][n]));
+            }
+            has_tags = ClusterDistributed(tags, p_n_ba[levc], tile_size, grid_eff, use_new_chop,
+                                          levf > useFixedUpToLevel(), dist_bx);
+        }
+        else
+        {
+            tags.collate(tagvec);
+            has_tags = tagvec.size() > 0;
+        }
         tags.clear();
 
-        if (tagvec.size() > 0)
+        if (has_tags)
         {
             //
             // Created new level, now generate efficient grids.
@@ -689,7 +717,16 @@ AmrMesh::MakeNewGrids (int lbase, Real time, int& new_finest, Vector<BoxArray>&
 
             if (levf > useFixedUpToLevel()) {
                 BoxList new_bx;
-                if (ParallelDescriptor::IOProcessor()) {
+                if (use_distributed_clustering && ParallelDescriptor::IOProcessor()) {
+                    new_bx = std::move(dist_bx);
+                    new_bx.refine(bf_lev[levc]);
+                    new_bx.simplify();
+
+                    if (new_bx.size()>0) {
+                        // Chop new grids outside domain
+                        new_bx.intersect(Geom(levc).Domain());
+                    }
+                } else if (ParallelDescriptor::IOProcessor()) {
                     BL_PROFILE("AmrMesh-cluster");
                     //
                     // Construct initial cluster.
@@ -723,6 +760,16 @@ AmrMesh::MakeNewGrids (int lbase, Real time, int& new_finest, Vector<BoxArray>&
                 BL_ASSERT(new_bx.isDisjoint());
 
                 new_grids[levf] = BoxArray(std::move(new_bx), max_grid_size[levf]);
+
+                if (incremental) {
+                    new_grids[levf] = IncrementalGrids(levf, new_grids[levf], p_n_incr,
+                                                       bf_lev[levc], nretained[levf]);
+                    if (verbose > 0) {
+                        amrex::Print() << "AmrMesh: kept " << nretained[levf] << " of "
+                                       << grids[levf].size() << " grids at level " << levf
+                                       << ", " << new_grids[levf].size() << " grids in total\n";
+                    }
+                }
             }
         }
     }
@@ -754,7 +801,7 @@ AmrMesh::MakeNewGrids (int lbase, Real time, int& new_finest, Vector<BoxArray>&
                 amrex::Abort("AmrMesh::MakeNewGrids: how did this happen?");
             }
         }
-        else if (refine_grid_layout)
+        else if (refine_grid_layout && nretained[lev] == 0)
         {
             ChopGrids(lev,new_grids[lev],ParallelDescriptor::NProcs());
             if (new_grids[lev] == grids[lev]) {
@@ -848,6 +895,296 @@ AmrMesh::MakeNewGrids (Real time)
     }
 }
 
+BoxArray
+AmrMesh::IncrementalGrids (int lev, const BoxArray& new_ba, const BoxArray& p_n_crse,
+                           const IntVect& bf_crse, int& nretained) const
+{
+    BL_PROFILE("AmrMesh::IncrementalGrids()");
+
+    nretained = 0;
+
+    const BoxArray& old_ba = grids[lev];
+    if (old_ba.empty() || new_ba.empty()) {
+        return new_ba;
+    }
+
+    BoxList retained;
+    for (int i = 0, N = old_ba.size(); i < N; ++i)
+    {
+        const Box& b = old_ba[i];
+        Long covered = 0;
+        for (auto const& is : new_ba.intersections(b)) {
+            covered += is.second.numPts();
+        }
+        if (covered == 0 || static_cast<Real>(covered) < grid_eff*static_cast<Real>(b.numPts())) {
+            continue;
+        }
+        Box cb = amrex::coarsen(amrex::coarsen(b, ref_ratio[lev-1]), bf_crse);
+        if (p_n_crse.contains(cb)) {
+            retained.push_back(b);
+        }
+    }
+
+    if (retained.isEmpty()) {
+        return new_ba;
+    }
+
+    nretained = retained.size();
+    BoxArray retained_ba(retained);
+
+    BoxList added;
+    for (int i = 0, N = new_ba.size(); i < N; ++i) {
+        BoxList bl;
+        bl.complementIn(new_ba[i], retained_ba);
+        added.catenate(bl);
+    }
+    added.simplify();
+    added.maxSize(max_grid_size[lev]);
+
+    retained.catenate(added);
+    return BoxArray(std::move(retained));
+}
+
+DistributionMapping
+AmrMesh::MakeIncrementalDistributionMap (int lev, const BoxArray& new_ba) const
+{
+    BL_PROFILE("AmrMesh::MakeIncrementalDistributionMap()");
+
+    if (lev > finest_level || grids[lev].empty() || dmap[lev].empty()) {
+        return DistributionMapping(new_ba);
+    }
+
+    const BoxArray& old_ba = grids[lev];
+    const int nprocs = ParallelDescriptor::NProcs();
+    const int nboxes = new_ba.size();
+
+    Vector<int> pmap(nboxes, -1);
+    Vector<Long> load(nprocs, 0);
+    Vector<int> unassigned;
+    for (int i = 0; i < nboxes; ++i)
+    {
+        const Box& b = new_ba[i];
+        for (auto const& is : old_ba.intersections(b)) {
+            if (old_ba[is.first] == b) {
+                pmap[i] = dmap[lev][is.first];
+                load[pmap[i]] += b.numPts();
+                break;
+            }
+        }
+        if (pmap[i] < 0) {
+            unassigned.push_back(i);
+        }
+    }
+
+    // Largest boxes first, each to the least loaded process
+    std::stable_sort(unassigned.begin(), unassigned.end(), [&] (int a, int b)
+                     { return new_ba[a].numPts() > new_ba[b].numPts(); });
+    for (int i : unassigned) {
+        const int iproc = static_cast<int>(std::min_element(load.begin(), load.end()) - load.begin());
+        pmap[i] = iproc;
+        load[iproc] += new_ba[i].numPts();
+    }
+
+    return DistributionMapping(std::move(pmap));
+}
+
+bool
+AmrMesh::ClusterDistributed (const TagBoxArray& tags, BoxArray& p_n_ba,
+                             const IntVect& tile_size, Real eff, bool new_chop,
+                             bool do_cluster, BoxList& new_bx)
+{
+    BL_PROFILE("AmrMesh::ClusterDistributed()");
+
+    new_bx.clear();
+
+    //
+    // Tiles covering the tag boxes, including their ghost cells.
+    //
+    BoxArray tag_ba = tags.boxArray();
+    tag_ba.grow(tags.nGrowVect());
+    BoxList tile_bl;
+    {
+        BoxArray all_tiles(tag_ba.minimalBox());
+        all_tiles.maxSize(tile_size);
+        for (int i = 0, N = all_tiles.size(); i < N; ++i) {
+            if (tag_ba.intersects(all_tiles[i])) {
+                tile_bl.push_back(all_tiles[i]);
+            }
+        }
+    }
+    BoxArray tile_ba(std::move(tile_bl));
+    DistributionMapping tile_dm(tile_ba);
+
+    //
+    // Move the tags to the tiles.  The tags are unique after
+    // mapPeriodicRemoveDuplicates, so adding them is the same as copying.
+    //
+    TagBoxArray tile_tags(tile_ba, tile_dm, IntVect(0));
+    tile_tags.ParallelAdd(tags, 0, 0, 1, tags.nGrowVect(), IntVect(0));
+
+    if (do_cluster) {
+        p_n_ba.removeOverlap();
+    }
+
+    //
+    // Cluster each tile on its owner.
+    //
+    const int nlocal = tile_tags.local_size();
+    Vector<Vector<Box> > local_boxes(nlocal);
+    Vector<Vector<Long> > local_ntags(nlocal);
+    Long ntags_local = 0;
+#ifdef AMREX_USE_OMP
+#pragma omp parallel reduction(+:ntags_local)
+#endif
+    for (MFIter mfi(tile_tags); mfi.isValid(); ++mfi)
+    {
+        Array4<char const> const& arr = tile_tags.const_array(mfi);
+        Box const& bx = mfi.validbox();
+        Vector<IntVect> tagvec;
+        AMREX_LOOP_3D(bx, i, j, k,
+        {
+            if (arr(i,j,k) != TagBox::CLEAR) {
+                tagvec.push_back(IntVect(AMREX_D_DECL(i,j,k)));
+            }
+        });
+        ntags_local += tagvec.size();
+
+        if (do_cluster && ! tagvec.empty())
+        {
+            ClusterList clist(tagvec.data(), tagvec.size());
+            if (new_chop) {
+                clist.new_chop(eff);
+            } else {
+                clist.chop(eff);
+            }
+            // Proper nesting domain restricted to this tile
+            BoxList pn_bl;
+            for (auto const& is : p_n_ba.intersections(bx)) {
+                pn_bl.push_back(is.second);
+            }
+            BoxArray pn_ba(std::move(pn_bl));
+            clist.intersect(pn_ba);
+
+            BoxList cbl;
+            clist.boxList(cbl);
+            const int li = mfi.LocalIndex();
+            local_boxes[li] = std::move(cbl.data());
+            local_ntags[li] = clist.numTags();
+        }
+    }
+
+    ParallelDescriptor::ReduceLongSum(ntags_local);
+    const bool has_tags = ntags_local > 0;
+    if ( ! has_tags || ! do_cluster) {
+        return has_tags;
+    }
+
+    Vector<Box> boxes;
+    Vector<Long> ntags;
+    for (int li = 0; li < nlocal; ++li) {
+        boxes.insert(boxes.end(), local_boxes[li].begin(), local_boxes[li].end());
+        ntags.insert(ntags.end(), local_ntags[li].begin(), local_ntags[li].end());
+    }
+
+#ifdef BL_USE_MPI
+    //
+    // Gather the boxes and their tag counts on the I/O processor.
+    //
+    {
+        const int IOProcNumber = ParallelDescriptor::IOProcessorNumber();
+        const int count = boxes.size();
+        const std::vector<int>& countvec = ParallelDescriptor::Gather(count, IOProcNumber);
+        std::vector<int> offset(countvec.size(),0);
+        Long count_tot = 0;
+        if (ParallelDescriptor::IOProcessor()) {
+            count_tot = countvec[0];
+            for (int i = 1, N = offset.size(); i < N; i++) {
+                offset[i] = offset[i-1] + countvec[i-1];
+                count_tot += countvec[i];
+            }
+        }
+        Vector<Box> all_boxes(std::max(count_tot,Long(1)));
+        Vector<Long> all_ntags(std::max(count_tot,Long(1)));
+        ParallelDescriptor::Gatherv(boxes.data(), count, all_boxes.data(), countvec, offset, IOProcNumber);
+        ParallelDescriptor::Gatherv(ntags.data(), count, all_ntags.data(), countvec, offset, IOProcNumber);
+        if ( ! ParallelDescriptor::IOProcessor()) {
+            return has_tags;
+        }
+        all_boxes.resize(count_tot);
+        all_ntags.resize(count_tot);
+        std::swap(boxes, all_boxes);
+        std::swap(ntags, all_ntags);
+    }
+#endif
+
+    //
+    // Merge neighboring boxes as long as the merged box is efficient,
+    // properly nested, and does not overlap any other box.
+    //
+    BL_PROFILE_VAR("AmrMesh::ClusterDistributed-merge", blp_merge);
+    bool merged = true;
+    while (merged)
+    {
+        merged = false;
+        const int nboxes = boxes.size();
+        BoxArray ba(boxes.data(), nboxes);
+        Vector<char> done(nboxes, 0);
+        Vector<Box> new_boxes;
+        Vector<Long> new_ntags;
+        Vector<Box> hulls; // merged boxes made in this pass
+        for (int i = 0; i < nboxes; ++i)
+        {
+            if (done[i]) continue;
+            done[i] = 1;
+
+            int jbest = -1;
+            Real effbest = eff;
+            Box hbest;
+            for (auto const& is : ba.intersections(amrex::grow(boxes[i],1)))
+            {
+                const int j = is.first;
+                if (done[j]) continue;
+                Box hull = boxes[i];
+                hull.minBox(boxes[j]);
+                const Real heff = static_cast<Real>(ntags[i]+ntags[j]) / static_cast<Real>(hull.d_numPts());
+                if (heff < effbest || (heff == effbest && jbest >= 0)) continue;
+                if ( ! p_n_ba.contains(hull,true)) continue;
+                bool overlap = false;
+                for (auto const& ish : ba.intersections(hull)) {
+                    if (ish.first != i && ish.first != j) {
+                        overlap = true;
+                        break;
+                    }
+                }
+                for (int ih = 0, nh = hulls.size(); ih < nh && ! overlap; ++ih) {
+                    overlap = hulls[ih].intersects(hull);
+                }
+                if (overlap) continue;
+                jbest = j;
+                effbest = heff;
+                hbest = hull;
+            }
+
+            if (jbest >= 0) {
+                done[jbest] = 1;
+                hulls.push_back(hbest);
+                new_boxes.push_back(hbest);
+                new_ntags.push_back(ntags[i]+ntags[jbest]);
+                merged = true;
+            } else {
+                new_boxes.push_back(boxes[i]);
+                new_ntags.push_back(ntags[i]);
+            }
+        }
+        std::swap(boxes, new_boxes);
+        std::swap(ntags, new_ntags);
+    }
+    BL_PROFILE_VAR_STOP(blp_merge);
+
+    new_bx = BoxList(std::move(boxes));
+    return has_tags;
+}
+
 void
 AmrMesh::ProjPeriodic (BoxList& blout, const Box& domain,
                        Array<int,AMREX_SPACEDIM> const& is_per)
@@ -1037,6 +1374,8 @@ std::ostream& operator<< (std::ostream& os, AmrMesh const& amr_mesh)
     os << "  refine_grid_layout_dims = " << amr_mesh.refine_grid_layout_dims << "\n";
     os << "  check_input = " << amr_mesh.check_input  << "\n";
     os << "  use_new_chop = " << amr_mesh.use_new_chop << "\n";
+    os << "  use_distributed_clustering = " << amr_mesh.use_distributed_clustering << "\n";
+    os << "  use_incremental_regrid = " << amr_mesh.use_incremental_regrid << "\n";
     os << "  iterate_on_new_grids = " << amr_mesh.iterate_on_new_grids << "\n";
     return os;
 }
@@ -526,6 +526,20 @@ ClusterList::boxList (BoxList& blst) const
     }
 }
 
+Vector<Long>
+ClusterList::numTags () const
+{
+    Vector<Long> ntags;
+    ntags.reserve(lst.size());
+    for (std::list<Cluster*>::const_iterator cli = lst.begin(), End = lst.end();
+         cli != End;
+         ++cli)
+    {
+        ntags.push_back((*cli)->numTag());
+    }
+    return ntags;
+}
+
 void
 ClusterList::chop (Real eff)
 {
@@ -571,6 +571,160 @@ FluxRegister::Reflux (MultiFab& mf, const MultiFab& volume, Orientation face,
     }
 }
 
+void
+FluxRegister::Reflux_nowait (MultiFab& mf, const MultiFab& volume, Real scale,
+                             int scomp, int dcomp, int nc, const Geometry& geom)
+{
+    BL_PROFILE("FluxRegister::Reflux_nowait()");
+
+    AMREX_ASSERT_WITH_MESSAGE(!m_reflux_data,
+                              "FluxRegister::Reflux_nowait: Reflux already in progress");
+
+    m_reflux_data = std::make_unique<RefluxData>();
+    m_reflux_data->mf = &mf;
+    m_reflux_data->volume = &volume;
+    m_reflux_data->scale = scale;
+    m_reflux_data->dcomp = dcomp;
+    m_reflux_data->nc = nc;
+
+    buildRefluxPatches(mf.boxArray(), mf.DistributionMap(), geom.periodicity());
+
+    for (OrientationIter fi; fi; ++fi)
+    {
+        const Orientation& face = fi();
+        const RefluxPatch& patch = m_reflux_patch[face];
+        if (patch.ba.empty()) { continue; }
+
+        MultiFab& flux = m_reflux_data->flux[face];
+        flux.define(patch.ba, patch.dm, nc, 0);
+        flux.setVal(0.0);
+
+        flux.ParallelCopy_nowait(bndry[face].m_mf, scomp, 0, nc, 0, 0, geom.periodicity());
+    }
+}
+
+void
+FluxRegister::buildRefluxPatches (const BoxArray& ba, const DistributionMapping& dm,
+                                  const Periodicity& period)
+{
+    if (m_reflux_patch_ba == ba && m_reflux_patch_dm == dm) { return; }
+
+    BL_PROFILE("FluxRegister::buildRefluxPatches()");
+
+    m_reflux_patch_ba = ba;
+    m_reflux_patch_dm = dm;
+
+    const std::vector<IntVect>& pshifts = period.shiftIntVect();
+    std::vector<std::pair<int,Box> > isects;
+
+    for (OrientationIter fi; fi; ++fi)
+    {
+        const Orientation face = fi();
+        const int idir = face.coordDir();
+        const BoxArray& bndry_ba = bndry[face].boxArray();
+
+        BoxList bl(IndexType(IntVect::TheDimensionVector(idir)));
+        Vector<int> pmap;
+        Vector<int>& grid = m_reflux_patch[face].grid;
+        grid.clear();
+
+        for (int i = 0, N = ba.size(); i < N; ++i)
+        {
+            // One box per coarse grid, bounding all the register faces on it,
+            // so that no face is refluxed twice.
+            const Box& fbx = amrex::surroundingNodes(ba[i], idir);
+            Box bbx;
+            bool found = false;
+            for (auto const& iv : pshifts)
+            {
+                bndry_ba.intersections(fbx+iv, isects);
+                for (auto const& is : isects)
+                {
+                    const Box& b = is.second - iv;
+                    if (found) {
+                        bbx.minBox(b);
+                    } else {
+                        bbx = b;
+                        found = true;
+                    }
+                }
+            }
+            if (found) {
+                bl.push_back(bbx);
+                pmap.push_back(dm[i]);
+                grid.push_back(i);
+            }
+        }
+
+        m_reflux_patch[face].ba = BoxArray(std::move(bl));
+        m_reflux_patch[face].dm = DistributionMapping(std::move(pmap));
+    }
+}
+
+void
+FluxRegister::Reflux_nowait (MultiFab& mf, Real scale, int scomp, int dcomp, int nc,
+                             const Geometry& geom)
+{
+    const Real* dx = geom.CellSize();
+
+    MultiFab volume(mf.boxArray(), mf.DistributionMap(), 1, 0,
+                    MFInfo(), mf.Factory());
+
+    volume.setVal(AMREX_D_TERM(dx[0],*dx[1],*dx[2]), 0, 1, 0);
+
+    Reflux_nowait(mf, volume, scale, scomp, dcomp, nc, geom);
+
+    m_reflux_data->volume_tmp = std::move(volume);
+    m_reflux_data->volume = &(m_reflux_data->volume_tmp);
+}
+
+void
+FluxRegister::Reflux_finish ()
+{
+    if (!m_reflux_data) { return; }
+
+    BL_PROFILE("FluxRegister::Reflux_finish()");
+
+    MultiFab& mf = *(m_reflux_data->mf);
+    MultiFab const& volume = *(m_reflux_data->volume);
+    const Real scale = m_reflux_data->scale;
+    const int dcomp = m_reflux_data->dcomp;
+    const int nc = m_reflux_data->nc;
+
+    for (OrientationIter fi; fi; ++fi)
+    {
+        const Orientation face = fi();
+        MultiFab& flux = m_reflux_data->flux[face];
+        if (flux.empty()) { continue; }
+        flux.ParallelCopy_finish();
+
+        const Vector<int>& grid = m_reflux_patch[face].grid;
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+        for (MFIter mfi(flux); mfi.isValid(); ++mfi)
+        {
+            // The cells whose low (high) face is on the register.
+            const int gi = grid[mfi.index()];
+            Box bx = amrex::enclosedCells(mfi.validbox());
+            bx.growLo(face.coordDir(), face.isLow() ? 1 : 0);
+            bx.growHi(face.coordDir(), face.isLow() ? 0 : 1);
+            bx &= mf.box(gi);
+            if (bx.isEmpty()) { continue; }
+            Array4<Real> const& sfab = mf.array(gi);
+            Array4<Real const> const& ffab = flux.const_array(mfi);
+            Array4<Real const> const& vfab = volume.const_array(gi);
+            AMREX_LAUNCH_HOST_DEVICE_LAMBDA (bx, tbx,
+            {
+                fluxreg_reflux(tbx, sfab, dcomp, ffab, vfab, nc, scale, face);
+            });
+        }
+    }
+
+    m_reflux_data.reset();
+}
+
 void
 FluxRegister::ClearInternalBorders (const Geometry& geom)
 {
@@ -821,4 +975,59 @@ FluxRegister::read (const std::string& name, std::istream& is)
     br->read(name,is);
 }
 
+void
+FluxRegisterGroup::add (FluxRegister& fr, MultiFab& mf, const MultiFab& volume, Real scale,
+                        int srccomp, int destcomp, int numcomp, const Geometry& crse_geom)
+{
+    m_fr.push_back(FRItem{&fr, &mf, &volume, scale, srccomp, destcomp, numcomp, &crse_geom});
+}
+
+void
+FluxRegisterGroup::add (FluxRegister& fr, MultiFab& mf, Real scale,
+                        int srccomp, int destcomp, int numcomp, const Geometry& crse_geom)
+{
+    m_fr.push_back(FRItem{&fr, &mf, nullptr, scale, srccomp, destcomp, numcomp, &crse_geom});
+}
+
+void
+FluxRegisterGroup::add (YAFluxRegister& fr, MultiFab& state, int dc)
+{
+    m_yafr.push_back(YAFRItem{&fr, &state, dc});
+}
+
+void
+FluxRegisterGroup::Reflux ()
+{
+    BL_PROFILE("FluxRegisterGroup::Reflux()");
+
+    for (auto const& item : m_fr) {
+        if (item.volume) {
+            item.fr->Reflux_nowait(*item.mf, *item.volume, item.scale,
+                                   item.scomp, item.dcomp, item.nc, *item.geom);
+        } else {
+            item.fr->Reflux_nowait(*item.mf, item.scale,
+                                   item.scomp, item.dcomp, item.nc, *item.geom);
+        }
+    }
+
+    for (auto const& item : m_yafr) {
+        item.fr->Reflux_nowait(*item.state, item.dc);
+    }
+
+    for (auto const& item : m_fr) {
+        item.fr->Reflux_finish();
+    }
+
+    for (auto const& item : m_yafr) {
+        item.fr->Reflux_finish();
+    }
+}
+
+void
+FluxRegisterGroup::clear ()
+{
+    m_fr.clear();
+    m_yafr.clear();
+}
+
 }
@@ -11,10 +11,15 @@ MFPCInterp          mf_pc_interp;
 MFCellConsLinInterp mf_cell_cons_interp(false);
 MFCellConsLinInterp mf_lincc_interp(true);
 MFCellBilinear      mf_cell_bilinear_interp;
+MFCellQuadratic     mf_quadratic_interp;
+MFCellConsQuartic   mf_quartic_interp;
 
 // Nodal
 MFNodeBilinear      mf_node_bilinear_interp;
 
+// Face
+MFFaceLinear        mf_face_linear_interp;
+
 Box
 MFPCInterp::CoarseBox (const Box& fine, const IntVect& ratio)
 {
@@ -362,6 +367,195 @@ MFCellBilinear::interp (MultiFab const& crsemf, int ccomp, MultiFab& finemf, int
     }
 }
 
+Box
+MFCellQuadratic::CoarseBox (const Box& fine, const IntVect& ratio)
+{
+    Box crse = amrex::coarsen(fine,ratio);
+    crse.grow(1);
+    return crse;
+}
+
+Box
+MFCellQuadratic::CoarseBox (const Box& fine, int ratio)
+{
+    Box crse = amrex::coarsen(fine,ratio);
+    crse.grow(1);
+    return crse;
+}
+
+void
+MFCellQuadratic::interp (MultiFab const& crsemf, int ccomp, MultiFab& finemf, int fcomp, int nc,
+                         IntVect const& ng, Geometry const& cgeom, Geometry const& fgeom,
+                         Box const& dest_domain, IntVect const& ratio,
+                         Vector<BCRec> const& bcs, int bcomp)
+{
+#if (AMREX_SPACEDIM == 1)
+    amrex::ignore_unused(crsemf,ccomp,finemf,fcomp,nc,ng,cgeom,fgeom,dest_domain,ratio,bcs,bcomp);
+    amrex::Abort("1D MFCellQuadratic::interp not supported");
+#else
+    AMREX_ASSERT(crsemf.nGrowVect() == 0);
+
+    Box const& cdomain = cgeom.Domain();
+#if (AMREX_SPACEDIM == 2)
+    constexpr int nslp = 5; // x, y, x^2, y^2, xy, in that order.
+    bool const is_rz = cgeom.IsRZ();
+    GeometryData const& cs_geomdata = cgeom.data();
+    GeometryData const& fn_geomdata = fgeom.data();
+#else
+    constexpr int nslp = 9; // x, y, z, x^2, y^2, z^2, xy, xz, yz, in that order.
+    amrex::ignore_unused(fgeom);
+#endif
+
+#ifdef AMREX_USE_GPU
+    if (Gpu::inLaunchRegion()) {
+        MultiFab crse_tmp(crsemf.boxArray(), crsemf.DistributionMap(), nslp*nc, 0);
+        auto const& crse = crsemf.const_arrays();
+        auto const& tmp = crse_tmp.arrays();
+        auto const& ctmp = crse_tmp.const_arrays();
+        auto const& fine = finemf.arrays();
+
+        Gpu::DeviceVector<BCRec> d_bc(nc);
+        BCRec const* pbc = d_bc.data();
+        Gpu::copyAsync(Gpu::hostToDevice, bcs.begin()+bcomp, bcs.begin()+bcomp+nc, d_bc.begin());
+
+        ParallelFor(crsemf, IntVect(-1), nc,
+        [=] AMREX_GPU_DEVICE (int box_no, int i, int j, int k, int n) noexcept
+        {
+            mf_cell_quadratic_calcslope(i,j,k,n, crse[box_no], ccomp, tmp[box_no], cdomain, pbc);
+        });
+
+#if (AMREX_SPACEDIM == 2)
+        if (is_rz) {
+            ParallelFor(finemf, ng, nc,
+            [=] AMREX_GPU_DEVICE (int box_no, int i, int j, int k, int n) noexcept
+            {
+                if (dest_domain.contains(i,j,k)) {
+                    mf_cell_quadratic_interp_rz(i,j,k,n, fine[box_no], fcomp, crse[box_no], ccomp,
+                                                ctmp[box_no], ratio, cs_geomdata, fn_geomdata);
+                }
+            });
+        } else
+#endif
+        {
+            ParallelFor(finemf, ng, nc,
+            [=] AMREX_GPU_DEVICE (int box_no, int i, int j, int k, int n) noexcept
+            {
+                if (dest_domain.contains(i,j,k)) {
+                    mf_cell_quadratic_interp(i,j,k,n, fine[box_no], fcomp, crse[box_no], ccomp,
+                                             ctmp[box_no], ratio);
+                }
+            });
+        }
+
+        Gpu::streamSynchronize();
+    } else
+#endif
+    {
+        BCRec const* pbc = bcs.data() + bcomp;
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel
+#endif
+        {
+            FArrayBox tmpfab;
+            for (MFIter mfi(finemf); mfi.isValid(); ++mfi) {
+                auto const& fine = finemf.array(mfi);
+                auto const& crse = crsemf.const_array(mfi);
+
+                Box const& cbox = amrex::grow(crsemf[mfi].box(), -1);
+                tmpfab.resize(cbox, nslp*nc);
+                auto const& tmp = tmpfab.array();
+                auto const& ctmp = tmpfab.const_array();
+
+                Box const& fbox = amrex::grow(mfi.validbox(), ng) & dest_domain;
+
+                amrex::LoopConcurrentOnCpu(cbox, nc,
+                [&] (int i, int j, int k, int n) noexcept
+                {
+                    mf_cell_quadratic_calcslope(i,j,k,n, crse, ccomp, tmp, cdomain, pbc);
+                });
+
+#if (AMREX_SPACEDIM == 2)
+                if (is_rz) {
+                    amrex::LoopConcurrentOnCpu(fbox, nc,
+                    [&] (int i, int j, int k, int n) noexcept
+                    {
+                        mf_cell_quadratic_interp_rz(i,j,k,n, fine, fcomp, crse, ccomp,
+                                                    ctmp, ratio, cs_geomdata, fn_geomdata);
+                    });
+                } else
+#endif
+                {
+                    amrex::LoopConcurrentOnCpu(fbox, nc,
+                    [&] (int i, int j, int k, int n) noexcept
+                    {
+                        mf_cell_quadratic_interp(i,j,k,n, fine, fcomp, crse, ccomp, ctmp, ratio);
+                    });
+                }
+            }
+        }
+    }
+#endif
+}
+
+Box
+MFCellConsQuartic::CoarseBox (const Box& fine, const IntVect& ratio)
+{
+    Box crse = amrex::coarsen(fine,ratio);
+    crse.grow(2);
+    return crse;
+}
+
+Box
+MFCellConsQuartic::CoarseBox (const Box& fine, int ratio)
+{
+    Box crse = amrex::coarsen(fine,ratio);
+    crse.grow(2);
+    return crse;
+}
+
+void
+MFCellConsQuartic::interp (MultiFab const& crsemf, int ccomp, MultiFab& finemf, int fcomp, int nc,
+                           IntVect const& ng, Geometry const&, Geometry const&,
+                           Box const& dest_domain, IntVect const& ratio,
+                           Vector<BCRec> const&, int)
+{
+    AMREX_ASSERT(crsemf.nGrowVect() == 0);
+    AMREX_ALWAYS_ASSERT(ratio == 2);
+    amrex::ignore_unused(ratio);
+
+#ifdef AMREX_USE_GPU
+    if (Gpu::inLaunchRegion()) {
+        auto const& crse = crsemf.const_arrays();
+        auto const& fine = finemf.arrays();
+        ParallelFor(finemf, ng, nc,
+        [=] AMREX_GPU_DEVICE (int box_no, int i, int j, int k, int n) noexcept
+        {
+            if (dest_domain.contains(i,j,k)) {
+                ccquartic_interp(i,j,k,n, Array4<Real const>(crse[box_no],ccomp),
+                                 Array4<Real>(fine[box_no],fcomp));
+            }
+        });
+        Gpu::streamSynchronize();
+    } else
+#endif
+    {
+#ifdef AMREX_USE_OMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(finemf); mfi.isValid(); ++mfi) {
+            auto const& fine = finemf.array(mfi,fcomp);
+            auto const& crse = crsemf.const_array(mfi,ccomp);
+            Box const& fbox = amrex::grow(mfi.validbox(), ng) & dest_domain;
+            amrex::LoopConcurrentOnCpu(fbox, nc,
+            [=] (int i, int j, int k, int n) noexcept
+            {
+                ccquartic_interp(i,j,k,n, crse, fine);
+            });
+        }
+    }
+}
+
 Box
 MFNodeBilinear::CoarseBox (const Box& fine, const IntVect& ratio)
 {
@@ -417,4 +611,98 @@ MFNodeBilinear::interp (MultiFab const& crsemf, int ccomp, MultiFab& finemf, int
     }
 }
 
+Box
+MFFaceLinear::CoarseBox (const Box& fine, const IntVect& ratio)
+{
+    Box crse = amrex::coarsen(fine,ratio);
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        if (crse.type(i) == IndexType::NODE && crse.length(i) < 2) {
+            crse.growHi(i,1); // Don't want degenerate boxes in nodal direction
+        }
+    }
+    return crse;
+}
+
+Box
+MFFaceLinear::CoarseBox (const Box& fine, int ratio)
+{
+    return CoarseBox(fine, IntVect(ratio));
+}
+
+void
+MFFaceLinear::interp (MultiFab const& crsemf, int ccomp, MultiFab& finemf, int fcomp, int nc,
+                      IntVect const& ng, Geometry const&, Geometry const&,
+                      Box const& dest_domain, IntVect const& ratio,
+                      Vector<BCRec> const&, int)
+{
+    IndexType const typ = finemf.ixType();
+    AMREX_ASSERT(AMREX_D_TERM(typ.nodeCentered(0),+typ.nodeCentered(1),+typ.nodeCentered(2)) == 1);
+    int const dir = AMREX_D_PICK(0, typ.nodeCentered(0) ? 0 : 1,
+                                    typ.nodeCentered(0) ? 0 : (typ.nodeCentered(1) ? 1 : 2));
+
+#ifdef AMREX_USE_GPU
+    if (Gpu::inLaunchRegion()) {
+        auto const& crse = crsemf.const_arrays();
+        auto const& fine = finemf.arrays();
+        ParallelFor(finemf, ng, nc,
+        [=] AMREX_GPU_DEVICE (int box_no, int i, int j, int k, int n) noexcept
+        {
+            if (dest_domain.contains(i,j,k)) {
+                Array4<Real> const farr(fine[box_no],fcomp);
+                Array4<Real const> const carr(crse[box_no],ccomp);
+                if (dir == 0) {
+                    face_linear_interp_x(i,j,k,n, farr, carr, ratio);
+                }
+#if (AMREX_SPACEDIM >= 2)
+                else if (dir == 1) {
+                    face_linear_interp_y(i,j,k,n, farr, carr, ratio);
+                }
+#endif
+#if (AMREX_SPACEDIM == 3)
+                else {
+                    face_linear_interp_z(i,j,k,n, farr, carr, ratio);
+                }
+#endif
+            }
+        });
+        Gpu::streamSynchronize();
+    } else
+#endif
+    {
+#ifdef AMREX_USE_OMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(finemf); mfi.isValid(); ++mfi) {
+            auto const& fine = finemf.array(mfi,fcomp);
+            auto const& crse = crsemf.const_array(mfi,ccomp);
+            Box const& fbox = amrex::grow(mfi.validbox(), ng) & dest_domain;
+            if (dir == 0) {
+                amrex::LoopConcurrentOnCpu(fbox, nc,
+                [=] (int i, int j, int k, int n) noexcept
+                {
+                    face_linear_interp_x(i,j,k,n, fine, crse, ratio);
+                });
+            }
+#if (AMREX_SPACEDIM >= 2)
+            else if (dir == 1) {
+                amrex::LoopConcurrentOnCpu(fbox, nc,
+                [=] (int i, int j, int k, int n) noexcept
+                {
+                    face_linear_interp_y(i,j,k,n, fine, crse, ratio);
+                });
+            }
+#endif
+#if (AMREX_SPACEDIM == 3)
+            else {
+                amrex::LoopConcurrentOnCpu(fbox, nc,
+                [=] (int i, int j, int k, int n) noexcept
+                {
+                    face_linear_interp_z(i,j,k,n, fine, crse, ratio);
+                });
+            }
+#endif
+        }
+    }
+}
+
 }
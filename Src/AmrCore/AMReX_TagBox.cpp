@@ -108,19 +108,65 @@ TagBox::buffer (const IntVect& a_nbuff, const IntVect& a_nwid) noexcept
     } else
 #endif
     {
-        AMREX_LOOP_3D(interior, i, j, k,
-        {
-            if (a(i,j,k) == TagBox::SET) {
-                for (int kk = k-nbuf.z; kk <= k+nbuf.z; ++kk) {
-                for (int jj = j-nbuf.y; jj <= j+nbuf.y; ++jj) {
-                for (int ii = i-nbuf.x; ii <= i+nbuf.x; ++ii) {
-                    if (a(ii,jj,kk) == TagBox::CLEAR) { a(ii,jj,kk) = TagBox::BUF; }
-                }}}
+        // Dilate the runs of SET cells rather than every SET cell.  Runs
+        // in the same row that overlap once grown in the first direction
+        // are merged, so each cell is visited at most once per row offset.
+        Vector<Run> runs;
+        getRuns(interior, runs, true);
+        int nmerged = 0;
+        for (int n = 0, nruns = runs.size(); n < nruns; ++n) {
+            Run r = runs[n];
+            r.lo[0] -= nbuf.x;
+            r.len += 2*nbuf.x;
+            if (nmerged > 0) {
+                Run& last = runs[nmerged-1];
+                bool same_row = true;
+                for (int idim = 1; idim < AMREX_SPACEDIM; ++idim) {
+                    same_row = same_row && (last.lo[idim] == r.lo[idim]);
+                }
+                if (same_row && r.lo[0] <= last.lo[0] + last.len) {
+                    last.len = r.lo[0] + r.len - last.lo[0];
+                    continue;
+                }
             }
-        });
+            runs[nmerged++] = r;
+        }
+        for (int n = 0; n < nmerged; ++n) {
+            Dim3 const lo = runs[n].lo.dim3();
+            int const ihi = lo.x + runs[n].len - 1;
+            for (int kk = lo.z-nbuf.z; kk <= lo.z+nbuf.z; ++kk) {
+            for (int jj = lo.y-nbuf.y; jj <= lo.y+nbuf.y; ++jj) {
+            for (int ii = lo.x; ii <= ihi; ++ii) {
+                if (a(ii,jj,kk) == TagBox::CLEAR) { a(ii,jj,kk) = TagBox::BUF; }
+            }}}
+        }
     }
 }
 
+void
+TagBox::getRuns (const Box& bx, Vector<Run>& runs, bool set_only) const noexcept
+{
+    Array4<char const> const& a = this->const_array();
+    const auto lo = amrex::lbound(bx);
+    const auto hi = amrex::ubound(bx);
+    for (int k = lo.z; k <= hi.z; ++k) {
+    for (int j = lo.y; j <= hi.y; ++j) {
+        int i = lo.x;
+        while (i <= hi.x) {
+            if (set_only ? (a(i,j,k) == TagBox::SET) : (a(i,j,k) != TagBox::CLEAR)) {
+                int const ilo = i;
+                while (i <= hi.x && (set_only ? (a(i,j,k) == TagBox::SET)
+                                              : (a(i,j,k) != TagBox::CLEAR))) {
+                    ++i;
+                }
+                runs.push_back(Run{IntVect(AMREX_D_DECL(ilo,j,k)), i-ilo});
+            } else {
+                ++i;
+            }
+        }
+    }}
+}
+
 // DEPRECATED
 Vector<int>
 TagBox::tags () const noexcept
@@ -380,20 +426,20 @@ TagBoxArray::local_collate_cpu (Gpu::PinnedVector<IntVect>& v) const
 {
     if (this->local_size() == 0) return;
 
+    // One sweep per box collects the runs of tags; the tags are then
+    // emitted from the runs without going over the boxes again.
+    Vector<Vector<TagBox::Run> > runs(this->local_size());
     Vector<int> count(this->local_size());
 #ifdef AMREX_USE_OMP
 #pragma omp parallel
 #endif
     for (MFIter fai(*this); fai.isValid(); ++fai)
     {
-        Array4<char const> const& arr = this->const_array(fai);
-        Box const& bx = fai.fabbox();
+        int li = fai.LocalIndex();
+        (*this)[fai].getRuns(fai.fabbox(), runs[li], false);
         int c = 0;
-        AMREX_LOOP_3D(bx,i,j,k,
-        {
-            if (arr(i,j,k) != TagBox::CLEAR) ++c;
-        });
-        count[fai.LocalIndex()] = c;
+        for (auto const& r : runs[li]) { c += r.len; }
+        count[li] = c;
     }
 
     Vector<int> offset(count.size()+1, 0);
@@ -404,21 +450,17 @@ TagBoxArray::local_collate_cpu (Gpu::PinnedVector<IntVect>& v) const
     if (v.empty()) return;
 
 #ifdef AMREX_USE_OMP
-#pragma omp parallel
+#pragma omp parallel for
 #endif
-    for (MFIter fai(*this); fai.isValid(); ++fai)
+    for (int li = 0; li < static_cast<int>(runs.size()); ++li)
     {
-        int li = fai.LocalIndex();
-        if (count[li] > 0) {
-            IntVect* p = v.data() + offset[li];
-            Array4<char const> const& arr = this->const_array(fai);
-            Box const& bx = fai.fabbox();
-            AMREX_LOOP_3D(bx,i,j,k,
-            {
-                if (arr(i,j,k) != TagBox::CLEAR) {
-                    *p++ = IntVect(AMREX_D_DECL(i,j,k));
-                }
-            });
+        IntVect* p = v.data() + offset[li];
+        for (auto const& r : runs[li]) {
+            IntVect iv = r.lo;
+            for (int n = 0; n < r.len; ++n) {
+                *p++ = iv;
+                ++iv[0];
+            }
         }
     }
 }
@@ -769,4 +811,66 @@ TagBoxArray::hasTags (Box const& a_bx) const
     return has_tags;
 }
 
+
+bool
+TagBoxArray::hasTagsOutside (BoxArray const& ba, IntVect const& nbuf, Box const& region) const
+{
+    bool has_tags = false;
+#ifdef AMREX_USE_GPU
+    if (Gpu::inLaunchRegion()) {
+        ReduceOps<ReduceOpLogicalOr> reduce_op;
+        ReduceData<int> reduce_data(reduce_op);
+        using ReduceTuple = typename decltype(reduce_data)::Type;
+
+        for (MFIter mfi(*this); mfi.isValid(); ++mfi)
+        {
+            const Box& vbx = mfi.validbox();
+            const Box& gbx = amrex::grow(vbx,nbuf) & region;
+            if (!gbx.ok()) continue;
+            const BoxList& uncovered = ba.complementIn(gbx);
+            const auto& arr = this->const_array(mfi);
+            for (const Box& u : uncovered) {
+                Box const& b = amrex::grow(u,nbuf) & vbx;
+                if (b.ok()) {
+                    reduce_op.eval(b, reduce_data,
+                    [=] AMREX_GPU_DEVICE (int i, int j, int k) -> ReduceTuple
+                    {
+                        int tr = arr(i,j,k) != TagBox::CLEAR;
+                        return {tr};
+                    });
+                }
+            }
+        }
+
+        ReduceTuple hv = reduce_data.value(reduce_op);
+        has_tags = static_cast<bool>(amrex::get<0>(hv));
+    } else
+#endif
+    {
+#ifdef AMREX_USE_OMP
+#pragma omp parallel reduction(||:has_tags)
+#endif
+        for (MFIter mfi(*this); mfi.isValid(); ++mfi)
+        {
+            const Box& vbx = mfi.validbox();
+            const Box& gbx = amrex::grow(vbx,nbuf) & region;
+            if (!gbx.ok()) continue;
+            const BoxList& uncovered = ba.complementIn(gbx);
+            Array4<char const> const& arr = this->const_array(mfi);
+            for (const Box& u : uncovered) {
+                Box const& b = amrex::grow(u,nbuf) & vbx;
+                if (b.ok() && !has_tags) {
+                    AMREX_LOOP_3D(b, i, j, k,
+                    {
+                        has_tags = has_tags || (arr(i,j,k) != TagBox::CLEAR);
+                    });
+                }
+            }
+        }
+    }
+
+    ParallelAllReduce::Or(has_tags, ParallelContext::CommunicatorSub());
+    return has_tags;
+}
+
 }
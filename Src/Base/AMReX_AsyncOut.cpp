@@ -4,8 +4,12 @@
 #include <AMReX_Vector.H>
 #include <AMReX_ParmParse.H>
 #include <AMReX_Utility.H>
+#include <AMReX_Print.H>
 #include <AMReX.H>
 
+#include <condition_variable>
+#include <mutex>
+
 namespace amrex {
 namespace AsyncOut {
 
@@ -19,21 +23,69 @@ int s_asyncout = true; // Have this on by default for DPC++ for now so that
 int s_asyncout = false;
 #endif
 int s_noutfiles = 64;
-MPI_Comm s_comm = MPI_COMM_NULL;
+int s_nthreads = 1;
+Long s_max_bytes = 0; // no limit
+bool s_overflow_sync = false;
+
+// One communicator per writer thread so that the Wait/Notify barriers of
+// jobs running concurrently in different threads do not match each other.
+Vector<MPI_Comm> s_comms;
 
-std::unique_ptr<BackgroundThread> s_thread;
+Vector<std::unique_ptr<BackgroundThread> > s_threads;
+int s_next_thread = 0;
+thread_local int t_ithread = 0;
 
 WriteInfo s_info;
 
+std::mutex s_mutx;
+std::condition_variable s_cond;
+Long s_bytes_in_flight = 0;
+int s_jobs_in_flight = 0;
+
+struct Stats {
+    Long njobs = 0;
+    Long nsync = 0;
+    int max_jobs_in_flight = 0;
+    Long max_bytes_in_flight = 0;
+    double job_time = 0.0;
+    double max_job_time = 0.0;
+    double blocked_time = 0.0;
+};
+Stats s_stats;
+
+void PrintStats ()
+{
+    if (s_stats.njobs > 0 && amrex::Verbose() > 0) {
+        amrex::Print() << "AsyncOut: " << s_stats.njobs << " jobs on " << s_nthreads
+                       << " thread(s), total job time = " << s_stats.job_time
+                       << ", max job time = " << s_stats.max_job_time << "\n"
+                       << "          max queue depth = " << s_stats.max_jobs_in_flight
+                       << ", max bytes in flight = " << s_stats.max_bytes_in_flight
+                       << ", time blocked on memory budget = " << s_stats.blocked_time
+                       << ", synchronous writes = " << s_stats.nsync << "\n";
+    }
+    s_stats = Stats{};
+}
+
 }
 
 void Initialize ()
 {
-    amrex::ignore_unused(s_comm,s_info);
+    amrex::ignore_unused(s_info);
 
     ParmParse pp("amrex");
     pp.query("async_out", s_asyncout);
     pp.query("async_out_nfiles", s_noutfiles);
+    pp.query("async_out_nthreads", s_nthreads);
+    pp.query("async_out_max_bytes", s_max_bytes);
+    std::string overflow("block");
+    pp.query("async_out_overflow", overflow);
+    if (overflow == "sync") {
+        s_overflow_sync = true;
+    } else if (overflow != "block") {
+        amrex::Abort("AsyncOut: amrex.async_out_overflow must be block or sync");
+    }
+    s_nthreads = std::max(s_nthreads, 1);
 
     int nprocs = ParallelDescriptor::NProcs();
     s_noutfiles = std::min(s_noutfiles, nprocs);
@@ -51,12 +103,18 @@ void Initialize ()
         }
         int myproc = ParallelDescriptor::MyProc();
         s_info = GetWriteInfo(myproc);
-        MPI_Comm_split(ParallelDescriptor::Communicator(), s_info.ifile, myproc, &s_comm);
+        s_comms.resize(s_nthreads, MPI_COMM_NULL);
+        MPI_Comm_split(ParallelDescriptor::Communicator(), s_info.ifile, myproc, &s_comms[0]);
+        for (int i = 1; i < s_nthreads; ++i) {
+            MPI_Comm_dup(s_comms[0], &s_comms[i]);
+        }
     }
 #endif
 
     if (s_asyncout) {
-        s_thread = std::make_unique<BackgroundThread>();
+        for (int i = 0; i < s_nthreads; ++i) {
+            s_threads.emplace_back(std::make_unique<BackgroundThread>());
+        }
     }
 
     ExecOnFinalize(Finalize);
@@ -64,14 +122,17 @@ void Initialize ()
 
 void Finalize ()
 {
-    if (s_thread) {
-        s_thread.reset();
-    }
+    s_threads.clear(); // The destructors finish the jobs.
+    s_next_thread = 0;
+
+    PrintStats();
 
 #ifdef AMREX_USE_MPI
-    if (s_comm != MPI_COMM_NULL) MPI_Comm_free(&s_comm);
-    s_comm = MPI_COMM_NULL;
+    for (auto& comm : s_comms) {
+        if (comm != MPI_COMM_NULL) MPI_Comm_free(&comm);
+    }
 #endif
+    s_comms.clear();
 }
 
 bool UseAsyncOut () { return s_asyncout; }
@@ -99,19 +160,65 @@ WriteInfo GetWriteInfo (int rank)
     return WriteInfo{ifile, ispot, nspots};
 }
 
-void Submit (std::function<void()>&& a_f)
+void Submit (std::function<void()>&& a_f, Long nbytes, bool collective)
 {
-    s_thread->Submit(std::move(a_f));
+    const int ithread = s_next_thread;
+    if (collective) {
+        s_next_thread = (s_next_thread+1) % s_nthreads;
+    }
+
+    {
+        std::lock_guard<std::mutex> lck(s_mutx);
+        ++s_jobs_in_flight;
+        s_stats.max_jobs_in_flight = std::max(s_stats.max_jobs_in_flight, s_jobs_in_flight);
+    }
+
+    s_threads[ithread]->Submit([f=std::move(a_f), nbytes, ithread] ()
+    {
+        t_ithread = ithread;
+        const double t0 = amrex::second();
+        f();
+        const double dt = amrex::second() - t0;
+
+        std::lock_guard<std::mutex> lck(s_mutx);
+        --s_jobs_in_flight;
+        s_bytes_in_flight -= nbytes;
+        ++s_stats.njobs;
+        s_stats.job_time += dt;
+        s_stats.max_job_time = std::max(s_stats.max_job_time, dt);
+        s_cond.notify_all();
+    });
 }
 
-void Submit (std::function<void()> const& a_f)
+void Submit (std::function<void()> const& a_f, Long nbytes, bool collective)
 {
-    s_thread->Submit(a_f);
+    Submit(std::function<void()>(a_f), nbytes, collective);
+}
+
+bool Reserve (Long nbytes)
+{
+    std::unique_lock<std::mutex> lck(s_mutx);
+    if (s_max_bytes > 0 && s_bytes_in_flight + nbytes > s_max_bytes) {
+        if (s_overflow_sync) {
+            ++s_stats.nsync;
+            return false;
+        }
+        const double t0 = amrex::second();
+        s_cond.wait(lck, [=] () -> bool {
+            return s_bytes_in_flight == 0 || s_bytes_in_flight + nbytes <= s_max_bytes;
+        });
+        s_stats.blocked_time += amrex::second() - t0;
+    }
+    s_bytes_in_flight += nbytes;
+    s_stats.max_bytes_in_flight = std::max(s_stats.max_bytes_in_flight, s_bytes_in_flight);
+    return true;
 }
 
 void Finish ()
 {
-    s_thread->Finish();
+    for (auto& t : s_threads) {
+        t->Finish();
+    }
 }
 
 void Wait ()
@@ -122,7 +229,7 @@ void Wait ()
         Vector<MPI_Request> reqs(N);
         Vector<MPI_Status> stats(N);
         for (int i = 0; i < N; ++i) {
-            reqs[i] = ParallelDescriptor::Abarrier(s_comm).req();
+            reqs[i] = ParallelDescriptor::Abarrier(s_comms[t_ithread]).req();
         }
         ParallelDescriptor::Waitall(reqs, stats);
     }
@@ -137,7 +244,7 @@ void Notify ()
         Vector<MPI_Request> reqs(N);
         Vector<MPI_Status> stats(N);
         for (int i = 0; i < N; ++i) {
-            reqs[i] = ParallelDescriptor::Abarrier(s_comm).req();
+            reqs[i] = ParallelDescriptor::Abarrier(s_comms[t_ithread]).req();
         }
         ParallelDescriptor::Waitall(reqs, stats);
     }
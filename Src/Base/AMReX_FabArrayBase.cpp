@@ -4,6 +4,7 @@
 #include <AMReX_Utility.H>
 #include <AMReX_Geometry.H>
 #include <AMReX_FArrayBox.H>
+#include <AMReX_MultiFab.H>
 #include <AMReX_NonLocalBC.H>
 
 #include <AMReX_BArena.H>
@@ -30,6 +31,7 @@ namespace amrex {
 // Set default values in Initialize()!!!
 //
 int     FabArrayBase::MaxComp;
+bool    FabArrayBase::fillpatch_scratch = false;
 
 #if defined(AMREX_USE_GPU)
 
@@ -101,6 +103,7 @@ FabArrayBase::Initialize ()
     // Set default values here!!!
     //
     FabArrayBase::MaxComp           = 25;
+    FabArrayBase::fillpatch_scratch = false;
 
     ParmParse pp("fabarray");
 
@@ -117,6 +120,7 @@ FabArrayBase::Initialize ()
     }
 
     pp.query("maxcomp",             FabArrayBase::MaxComp);
+    pp.query("fillpatch_scratch",   FabArrayBase::fillpatch_scratch);
 
     if (MaxComp < 1) {
         MaxComp = 1;
@@ -1814,6 +1818,40 @@ FabArrayBase::FPinfo::~FPinfo ()
 {
 }
 
+bool
+FabArrayBase::FPinfo::lockScratch () const
+{
+    if (!fillpatch_scratch || m_scratch_locked) return false;
+    m_scratch_locked = true;
+    return true;
+}
+
+void
+FabArrayBase::FPinfo::unlockScratch () const
+{
+    m_scratch_locked = false;
+}
+
+MultiFab&
+FabArrayBase::FPinfo::crsePatchScratch (int ncomp) const
+{
+    if (!m_crse_patch_scratch || m_crse_patch_scratch->nComp() < ncomp) {
+        m_crse_patch_scratch = std::make_unique<MultiFab>(ba_crse_patch, dm_patch, ncomp, 0,
+                                                          MFInfo(), *fact_crse_patch);
+    }
+    return *m_crse_patch_scratch;
+}
+
+MultiFab&
+FabArrayBase::FPinfo::finePatchScratch (int ncomp) const
+{
+    if (!m_fine_patch_scratch || m_fine_patch_scratch->nComp() < ncomp) {
+        m_fine_patch_scratch = std::make_unique<MultiFab>(ba_fine_patch, dm_patch, ncomp, 0,
+                                                          MFInfo(), *fact_fine_patch);
+    }
+    return *m_fine_patch_scratch;
+}
+
 Long
 FabArrayBase::FPinfo::bytes () const
 {
@@ -1889,6 +1927,7 @@ FabArrayBase::flushFPinfo (bool no_assertion)
     BL_ASSERT(no_assertion || getBDKey() == m_bdkey);
 
     std::vector<FPinfoCacheIter> others;
+    std::vector<FPinfo*> to_delete;
 
     std::pair<FPinfoCacheIter,FPinfoCacheIter> er_it = m_TheFillPatchCache.equal_range(m_bdkey);
 
@@ -1915,7 +1954,7 @@ FabArrayBase::flushFPinfo (bool no_assertion)
         m_FPinfo_stats.bytes -= it->second->bytes();
 #endif
         m_FPinfo_stats.recordErase(it->second->m_nuse);
-        delete it->second;
+        to_delete.push_back(it->second);
     }
 
     m_TheFillPatchCache.erase(er_it.first, er_it.second);
@@ -1925,6 +1964,11 @@ FabArrayBase::flushFPinfo (bool no_assertion)
     {
         m_TheFillPatchCache.erase(*it);
     }
+
+    // Deleting the scratch data in FPinfo may flush other caches.
+    for (FPinfo* p : to_delete) {
+        delete p;
+    }
 }
 
 FabArrayBase::CFinfo::CFinfo (const FabArrayBase& finefa,
@@ -5,6 +5,11 @@
 #include <AMReX_REAL.H>
 #include <AMReX_Utility.H>
 
+#ifdef AMREX_USE_OMP
+#include <omp.h>
+#endif
+
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
@@ -905,6 +910,153 @@ operator>> (std::istream&   is,
     return is;
 }
 
+//
+// Fast paths for the IEEE formats that show up in practice: 32- and 64-bit
+// numbers stored either in the native byte order or in the reverse of it.
+// A conversion between two of these is a byte swap of the input (if any),
+// a static_cast between float and double (if needed), and a byte swap of
+// the output (if any).  The loops are written so that the compiler can turn
+// the byte swaps into vector shuffles, and they are threaded with OpenMP
+// when the buffer is large enough.
+//
+
+namespace {
+
+constexpr Long fast_convert_omp_threshold = 65536;
+
+AMREX_FORCE_INLINE
+std::uint32_t byte_swap (std::uint32_t x) noexcept
+{
+    return ((x & 0x000000FFU) << 24) | ((x & 0x0000FF00U) <<  8) |
+           ((x & 0x00FF0000U) >>  8) | ((x & 0xFF000000U) >> 24);
+}
+
+AMREX_FORCE_INLINE
+std::uint64_t byte_swap (std::uint64_t x) noexcept
+{
+    return ((x & 0x00000000000000FFULL) << 56) | ((x & 0x000000000000FF00ULL) << 40) |
+           ((x & 0x0000000000FF0000ULL) << 24) | ((x & 0x00000000FF000000ULL) <<  8) |
+           ((x & 0x000000FF00000000ULL) >>  8) | ((x & 0x0000FF0000000000ULL) >> 24) |
+           ((x & 0x00FF000000000000ULL) >> 40) | ((x & 0xFF00000000000000ULL) >> 56);
+}
+
+template <typename T> struct IEEEBits;
+template <> struct IEEEBits<float>  { using type = std::uint32_t; };
+template <> struct IEEEBits<double> { using type = std::uint64_t; };
+
+template <typename TI, typename TO, bool SwapIn, bool SwapOut>
+void
+fast_convert (void* out, const void* in, Long nitems)
+{
+    using UI = typename IEEEBits<TI>::type;
+    using UO = typename IEEEBits<TO>::type;
+    static_assert(sizeof(UI) == sizeof(TI) && sizeof(UO) == sizeof(TO),
+                  "fast_convert: unexpected floating-point size");
+
+    auto pin  = static_cast<const char*>(in);
+    auto pout = static_cast<char*>(out);
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel for if (nitems >= fast_convert_omp_threshold && !omp_in_parallel())
+#endif
+    for (Long i = 0; i < nitems; ++i)
+    {
+        UI ui;
+        std::memcpy(&ui, pin + i*sizeof(UI), sizeof(UI));
+        if (SwapIn) { ui = byte_swap(ui); }
+        TI x;
+        std::memcpy(&x, &ui, sizeof(UI));
+        auto y = static_cast<TO>(x);
+        UO uo;
+        std::memcpy(&uo, &y, sizeof(UO));
+        if (SwapOut) { uo = byte_swap(uo); }
+        std::memcpy(pout + i*sizeof(UO), &uo, sizeof(UO));
+    }
+}
+
+template <typename TI, typename TO>
+void
+fast_convert (void* out, const void* in, Long nitems, bool swap_in, bool swap_out)
+{
+    if (swap_in) {
+        if (swap_out) {
+            fast_convert<TI,TO,true ,true >(out, in, nitems);
+        } else {
+            fast_convert<TI,TO,true ,false>(out, in, nitems);
+        }
+    } else {
+        if (swap_out) {
+            fast_convert<TI,TO,false,true >(out, in, nitems);
+        } else {
+            fast_convert<TI,TO,false,false>(out, in, nitems);
+        }
+    }
+}
+
+//
+// Returns true if rd is an IEEE 32- or 64-bit format whose byte order is
+// either the native one or its exact reverse.
+//
+bool
+ieee_layout (const RealDescriptor& rd, int& nbytes, bool& swapped)
+{
+    const RealDescriptor* native = nullptr;
+    if (rd.formatarray() == FPC::Native32RealDescriptor().formatarray()) {
+        native = &FPC::Native32RealDescriptor();
+    } else if (rd.formatarray() == FPC::Native64RealDescriptor().formatarray()) {
+        native = &FPC::Native64RealDescriptor();
+    } else {
+        return false;
+    }
+
+    const Vector<int>& nord = native->orderarray();
+    const Vector<int>& rord = rd.orderarray();
+    const int n = native->numBytes();
+    if (rord.size() != n) {
+        return false;
+    }
+
+    nbytes = n;
+    if (rord == nord) {
+        swapped = false;
+        return true;
+    }
+    for (int i = 0; i < n; ++i) {
+        if (rord[i] != nord[n-1-i]) {
+            return false;
+        }
+    }
+    swapped = true;
+    return true;
+}
+
+bool
+PD_fast_convert (void*                 out,
+                 const void*           in,
+                 Long                  nitems,
+                 const RealDescriptor& ord,
+                 const RealDescriptor& ird)
+{
+    int inbytes, outbytes;
+    bool swap_in, swap_out;
+    if (! ieee_layout(ird, inbytes, swap_in) || ! ieee_layout(ord, outbytes, swap_out)) {
+        return false;
+    }
+
+    if (inbytes == 4 && outbytes == 4) {
+        fast_convert<float,float>(out, in, nitems, swap_in, swap_out);
+    } else if (inbytes == 4 && outbytes == 8) {
+        fast_convert<float,double>(out, in, nitems, swap_in, swap_out);
+    } else if (inbytes == 8 && outbytes == 4) {
+        fast_convert<double,float>(out, in, nitems, swap_in, swap_out);
+    } else {
+        fast_convert<double,double>(out, in, nitems, swap_in, swap_out);
+    }
+    return true;
+}
+
+}
+
 static
 void
 PD_convert (void*                 out,
@@ -923,23 +1075,14 @@ PD_convert (void*                 out,
         BL_ASSERT(int(n) == nitems);
         memcpy(out, in, n*ord.numBytes());
     }
+    else if (boffs == 0 && ! onescmp && PD_fast_convert(out, in, nitems, ord, ird))
+    {
+        // Done.
+    }
     else if (ord.formatarray() == ird.formatarray() && boffs == 0 && ! onescmp) {
         permute_real_word_order(out, in, nitems,
                                 ord.order(), ird.order(), ord.numBytes());
     }
-    else if (ird == FPC::NativeRealDescriptor() && ord == FPC::Native32RealDescriptor()) {
-      auto rIn = static_cast<const char*>(in);
-      auto rOut= static_cast<char*>(out);
-      for(Long i(0); i < nitems; ++i) {
-        Real x;
-        float y;
-        std::memcpy(&x, rIn, sizeof(Real));
-        y = static_cast<float>(x);
-        std::memcpy(rOut, &y, sizeof(float));
-        rOut += sizeof(float);
-        rIn += sizeof(Real);
-      }
-    }
     else
     {
         PD_fconvert(out, in, nitems, boffs, ord.format(), ord.order(),
@@ -2,6 +2,9 @@
 #include <AMReX_ParallelDescriptor.H>
 #include <AMReX_VisMF.H>
 #include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
 
 namespace amrex {
 
@@ -127,19 +130,141 @@ MultiFab
 PlotFileDataImpl::get (int level, std::string const& varname) noexcept
 {
     MultiFab mf(m_ba[level], m_dmap[level], 1, m_ngrow[level]);
-    auto r = std::find(std::begin(m_var_names), std::end(m_var_names), varname);
-    if (r == std::end(m_var_names)) {
-        amrex::Abort("PlotFileDataImpl::get: varname not found "+varname);
-    } else {
-        int icomp = std::distance(std::begin(m_var_names), r);
-        for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
-            int gid = mfi.index();
-            FArrayBox& dstfab = mf[mfi];
-            std::unique_ptr<FArrayBox> srcfab(m_vismf[level]->readFAB(gid, icomp));
-            dstfab.copy<RunOn::Host>(*srcfab);
+    const int icomp = varIndex(varname);
+    for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
+        int gid = mfi.index();
+        FArrayBox& dstfab = mf[mfi];
+        std::unique_ptr<FArrayBox> srcfab(m_vismf[level]->readFAB(gid, icomp));
+        dstfab.copy<RunOn::Host>(*srcfab);
+    }
+    return mf;
+}
+
+MultiFab
+PlotFileDataImpl::get (int level, Vector<std::string> const& varnames,
+                       BoxArray const& ba, DistributionMapping const& dm) noexcept
+{
+    const int nvars = varnames.size();
+    Vector<int> icomps(nvars);
+    for (int n = 0; n < nvars; ++n) {
+        icomps[n] = varIndex(varnames[n]);
+    }
+
+    MultiFab mf(ba, dm, nvars, 0);
+    mf.setVal(0.0);
+
+    // On-disk FABs needed by this process and the local (gid, box) pairs they fill.
+    std::map<int,Vector<std::pair<int,Box> > > plan;
+    std::vector<std::pair<int,Box> > isects;
+    for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
+        m_ba[level].intersections(mfi.validbox(), isects);
+        for (auto const& is : isects) {
+            plan[is.first].emplace_back(mfi.index(), is.second);
+        }
+    }
+
+    for (auto const& kv : plan) {
+        for (int n = 0; n < nvars; ++n) {
+            std::unique_ptr<FArrayBox> srcfab(m_vismf[level]->readFAB(kv.first, icomps[n]));
+            for (auto const& dst : kv.second) {
+                mf[dst.first].copy<RunOn::Host>(*srcfab, dst.second, 0, dst.second, n, 1);
+            }
         }
     }
+
     return mf;
 }
 
+MultiFab
+PlotFileDataImpl::get (int level, Box const& region, Vector<std::string> const& varnames) noexcept
+{
+    const IndexType ixtyp = m_ba[level].ixType();
+    const Box& bx = amrex::convert(region, ixtyp) & amrex::convert(m_prob_domain[level], ixtyp);
+
+    BoxList bl(ixtyp);
+    if (bx.ok()) {
+        for (auto const& is : m_ba[level].intersections(bx)) {
+            bl.push_back(is.second);
+        }
+    }
+
+    if (bl.isEmpty()) {
+        return MultiFab();
+    }
+
+    BoxArray ba(std::move(bl));
+    DistributionMapping dm(ba);
+    return get(level, varnames, ba, dm);
+}
+
+MultiFab
+PlotFileDataImpl::get (int level, RealBox const& region, Vector<std::string> const& varnames) noexcept
+{
+    const Box& domain = m_prob_domain[level];
+    Box bx = domain;
+    for (int idim = 0; idim < m_spacedim; ++idim) {
+        const Real dx = m_cell_size[level][idim];
+        const int ilo = static_cast<int>(std::floor((region.lo(idim)-m_prob_lo[idim])/dx));
+        const int ihi = static_cast<int>(std::ceil ((region.hi(idim)-m_prob_lo[idim])/dx)) - 1;
+        bx.setSmall(idim, domain.smallEnd(idim) + std::max(ilo, 0));
+        bx.setBig  (idim, domain.smallEnd(idim) + std::max(ihi, ilo));
+    }
+    return get(level, bx, varnames);
+}
+
+bool
+PlotFileDataImpl::minMax (int level, std::string const& varname, Real& vmin, Real& vmax) const noexcept
+{
+    const int icomp = varIndex(varname);
+    VisMF const& vismf = *m_vismf[level];
+
+    constexpr Real no_min = std::numeric_limits<Real>::max();
+    constexpr Real no_max = std::numeric_limits<Real>::lowest();
+
+    vmin = vismf.min(icomp);
+    vmax = vismf.max(icomp);
+    if (vmin != no_min || vmax != no_max) {
+        return true;
+    }
+
+    for (int i = 0, N = vismf.size(); i < N; ++i) {
+        const Real fmin = vismf.min(i, icomp);
+        const Real fmax = vismf.max(i, icomp);
+        if (fmin == no_min && fmax == no_max) {
+            return false;
+        }
+        vmin = std::min(vmin, fmin);
+        vmax = std::max(vmax, fmax);
+    }
+    return vismf.size() > 0;
+}
+
+FArrayBox
+PlotFileDataImpl::getFab (int level, int gid, std::string const& varname) noexcept
+{
+    std::unique_ptr<FArrayBox> fab(m_vismf[level]->readFAB(gid, varIndex(varname)));
+    return std::move(*fab);
+}
+
+bool
+PlotFileDataImpl::minMax (int level, int gid, std::string const& varname,
+                          Real& vmin, Real& vmax) const noexcept
+{
+    const int icomp = varIndex(varname);
+    vmin = m_vismf[level]->min(gid, icomp);
+    vmax = m_vismf[level]->max(gid, icomp);
+    return vmin != std::numeric_limits<Real>::max()
+        || vmax != std::numeric_limits<Real>::lowest();
+}
+
+int
+PlotFileDataImpl::varIndex (std::string const& varname) const noexcept
+{
+    auto r = std::find(std::begin(m_var_names), std::end(m_var_names), varname);
+    if (r == std::end(m_var_names)) {
+        amrex::Abort("PlotFileDataImpl: varname not found "+varname);
+    }
+    return static_cast<int>(std::distance(std::begin(m_var_names), r));
+}
+
 }
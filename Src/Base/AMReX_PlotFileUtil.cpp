@@ -208,7 +208,8 @@ WriteMultiLevelPlotfile (const std::string& plotfilename, int nlevels,
         };
 
         if (AsyncOut::UseAsyncOut()) {
-            AsyncOut::Submit(std::move(f));
+            // Only this process writes the header.
+            AsyncOut::Submit(std::move(f), 0, false);
         } else {
             f();
         }
@@ -7,6 +7,7 @@
 #include <AMReX_FabArrayUtility.H>
 #include <AMReX_AsyncOut.H>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cerrno>
@@ -15,6 +16,7 @@
 #include <fstream>
 #include <iostream>
 #include <limits>
+#include <map>
 #include <memory>
 #include <numeric>
 #include <sstream>
@@ -37,6 +39,7 @@ bool VisMF::useSingleWrite(false);
 bool VisMF::checkFilePositions(false);
 bool VisMF::usePersistentIFStreams(false);
 bool VisMF::useSynchronousReads(false);
+bool VisMF::useElasticReads(false);
 bool VisMF::useDynamicSetSelection(true);
 bool VisMF::allowSparseWrites(true);
 
@@ -84,6 +87,7 @@ VisMF::Initialize ()
     pp.query("checkfilepositions", checkFilePositions);
     pp.query("usepersistentifstreams", usePersistentIFStreams);
     pp.query("usesynchronousreads", useSynchronousReads);
+    pp.query("useelasticreads", useElasticReads);
     pp.query("usedynamicsetselection", useDynamicSetSelection);
     pp.query("iobuffersize", ioBufferSize);
     pp.query("allowsparsewrites", allowSparseWrites);
@@ -1511,6 +1515,200 @@ VisMF::readFAB (FabArray<FArrayBox> &mf,
 }
 
 
+namespace {
+
+// ---- An istream source over a buffer already in memory.
+class MemoryStreamBuf
+    : public std::streambuf
+{
+public:
+    MemoryStreamBuf (char* p, Long n) { setg(p, p, p + n); }
+};
+
+struct ElasticReadItem
+{
+    int  fileIndex;
+    Long offset;
+    Long nBytes;   // ---- exact for NoFabHeader, an estimate otherwise
+    int  faIndex;
+};
+
+// ---- Upper limit on the size of a single read.
+constexpr Long elasticReadChunkSize = 256*1024*1024;
+
+}
+
+void
+VisMF::ReadElastic (FabArray<FArrayBox> &mf,
+                    const std::string   &mf_name,
+                    const VisMF::Header &hdr,
+                    double              &copyTime)
+{
+    BL_PROFILE("VisMF::ReadElastic()");
+
+    const int myProc(ParallelDescriptor::MyProc());
+    const int nProcs(ParallelDescriptor::NProcs());
+    const int nBoxes(hdr.m_ba.size());
+    const bool noFabHeader(NoFabHeader(hdr));
+    const int nBytesPerReal = noFabHeader ? hdr.m_writtenRD.numBytes()
+                                          : FPC::NativeRealDescriptor().numBytes();
+
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(mf.nGrowVect().allGE(hdr.m_ngrow),
+                                     "VisMF::ReadElastic:  mf has fewer ghost cells than on disk");
+
+    // ---- Every rank builds the same plan from the header:  the FABs
+    // ---- sorted by file and offset, cut into contiguous ranges of
+    // ---- roughly equal size, one per reader.
+
+    std::map<std::string, int> fileIndices;
+    for(int i(0); i < nBoxes; ++i) {
+      fileIndices.insert(std::make_pair(hdr.m_fod[i].m_name, 0));
+    }
+    Vector<std::string> fileNames;
+    for(auto& fi : fileIndices) {
+      fi.second = fileNames.size();
+      fileNames.push_back(fi.first);
+    }
+    const int nFiles(fileNames.size());
+
+    Vector<ElasticReadItem> plan(nBoxes);
+    for(int i(0); i < nBoxes; ++i) {
+      Box bx(amrex::grow(hdr.m_ba[i], hdr.m_ngrow));
+      plan[i].fileIndex = fileIndices[hdr.m_fod[i].m_name];
+      plan[i].offset    = hdr.m_fod[i].m_head;
+      plan[i].nBytes    = bx.numPts() * hdr.m_ncomp * nBytesPerReal;
+      plan[i].faIndex   = i;
+    }
+    std::sort(plan.begin(), plan.end(), [] (const ElasticReadItem& a, const ElasticReadItem& b)
+              { return std::make_pair(a.fileIndex, a.offset) < std::make_pair(b.fileIndex, b.offset); });
+
+    // ---- Limit the number of readers to about nMFFileInStreams per file
+    // ---- and spread them over the ranks.
+    const int nReaders(std::min(nProcs, nFiles * nMFFileInStreams));
+    Long totalBytes(0);
+    for(const auto& item : plan) {
+      totalBytes += item.nBytes;
+    }
+
+    Vector<int> readRanks(nBoxes);
+    Vector<int> planReader(nBoxes);
+    Long bytesBefore(0);
+    for(int ip(0); ip < nBoxes; ++ip) {
+      const Long mid(bytesBefore + plan[ip].nBytes / 2);
+      int reader = static_cast<int>((static_cast<double>(mid) * nReaders) / std::max(totalBytes, Long(1)));
+      reader = std::min(std::max(reader, ip > 0 ? planReader[ip-1] : 0), nReaders - 1);
+      planReader[ip] = reader;
+      readRanks[plan[ip].faIndex] = static_cast<int>((static_cast<Long>(reader) * nProcs) / nReaders);
+      bytesBefore += plan[ip].nBytes;
+    }
+
+    DistributionMapping dmRead(std::move(readRanks));
+    const bool readInPlace(dmRead == mf.DistributionMap() && mf.nGrowVect() == hdr.m_ngrow);
+
+    FabArray<FArrayBox> fafabRead;
+    if( ! readInPlace) {
+      fafabRead.define(mf.boxArray(), dmRead, hdr.m_ncomp, hdr.m_ngrow, MFInfo(), mf.Factory());
+    }
+    FabArray<FArrayBox> &whichFA = readInPlace ? mf : fafabRead;
+
+    // ---- Read my range in chunks of consecutive FABs in the same file.
+
+    int ipBegin(0);
+    while(ipBegin < nBoxes && dmRead[plan[ipBegin].faIndex] != myProc) {
+      ++ipBegin;
+    }
+    int ipEnd(ipBegin);
+    while(ipEnd < nBoxes && dmRead[plan[ipEnd].faIndex] == myProc) {
+      ++ipEnd;
+    }
+
+    Vector<char> chunk;
+    int ip(ipBegin);
+    while(ip < ipEnd) {
+      const int fileIndex(plan[ip].fileIndex);
+      std::string fullFileName(VisMF::DirName(mf_name) + fileNames[fileIndex]);
+      std::ifstream *infs = VisMF::OpenStream(fullFileName);
+
+      // ---- With FAB headers, a FAB extends to the start of the next one.
+      Long fileSize(-1);
+      auto fabEnd = [&] (int jp) -> Long {
+        if(noFabHeader) {
+          return plan[jp].offset + plan[jp].nBytes;
+        } else if(jp + 1 < nBoxes && plan[jp+1].fileIndex == fileIndex) {
+          return plan[jp+1].offset;
+        } else {
+          if(fileSize < 0) {
+            infs->seekg(0, std::ios::end);
+            fileSize = static_cast<Long>(infs->tellg());
+          }
+          return fileSize;
+        }
+      };
+
+      while(ip < ipEnd && plan[ip].fileIndex == fileIndex) {
+        const Long chunkBegin(plan[ip].offset);
+        int jp(ip);
+        Long chunkEnd(fabEnd(jp));
+        while(jp + 1 < ipEnd && plan[jp+1].fileIndex == fileIndex &&
+              plan[jp+1].offset == chunkEnd &&
+              fabEnd(jp+1) - chunkBegin <= elasticReadChunkSize)
+        {
+          ++jp;
+          chunkEnd = fabEnd(jp);
+        }
+
+        chunk.resize(chunkEnd - chunkBegin);
+        infs->seekg(chunkBegin, std::ios::beg);
+        infs->read(chunk.dataPtr(), chunk.size());
+        if( ! infs->good()) {
+          amrex::Abort("VisMF::ReadElastic:  failed to read " + fullFileName);
+        }
+
+        for(int kp(ip); kp <= jp; ++kp) {
+          char *fabPtr = chunk.dataPtr() + (plan[kp].offset - chunkBegin);
+          FArrayBox &fab = whichFA[plan[kp].faIndex];
+          if(noFabHeader) {
+            Real* fabdata = fab.dataPtr();
+#ifdef AMREX_USE_GPU
+            std::unique_ptr<FArrayBox> hostfab;
+            if (fab.arena()->isManaged() || fab.arena()->isDevice()) {
+                hostfab = std::make_unique<FArrayBox>(fab.box(), fab.nComp(), The_Pinned_Arena());
+                fabdata = hostfab->dataPtr();
+            }
+#endif
+            if(hdr.m_writtenRD == FPC::NativeRealDescriptor()) {
+              memcpy(fabdata, fabPtr, fab.nBytes());
+            } else {
+              RealDescriptor::convertToNativeFormat(fabdata, fab.box().numPts() * fab.nComp(),
+                                                    fabPtr, hdr.m_writtenRD);
+            }
+#ifdef AMREX_USE_GPU
+            if (hostfab) {
+                Gpu::htod_memcpy_async(fab.dataPtr(), hostfab->dataPtr(), fab.size()*sizeof(Real));
+                Gpu::streamSynchronize();
+            }
+#endif
+          } else {
+            MemoryStreamBuf msb(fabPtr, fabEnd(kp) - plan[kp].offset);
+            std::istream fabStream(&msb);
+            fab.readFrom(fabStream);
+          }
+        }
+
+        ip = jp + 1;
+      }
+
+      VisMF::CloseStream(fullFileName);
+    }
+
+    if( ! readInPlace) {
+      copyTime = amrex::second();
+      mf.Redistribute(fafabRead, 0, 0, hdr.m_ncomp, hdr.m_ngrow);
+      copyTime = amrex::second() - copyTime;
+    }
+}
+
+
 void
 VisMF::Read (FabArray<FArrayBox> &mf,
              const std::string   &mf_name,
@@ -1577,7 +1775,11 @@ VisMF::Read (FabArray<FArrayBox> &mf,
   int nProcs(ParallelDescriptor::NProcs());
   bool noFabHeader(NoFabHeader(hdr));
 
-  if(noFabHeader && useSynchronousReads) {
+  if(useElasticReads) {
+
+    VisMF::ReadElastic(mf, mf_name, hdr, faCopyTime);
+
+  } else if(noFabHeader && useSynchronousReads) {
 
     // ---- This code is only for reading in file order
     bool doConvert(hdr.m_writtenRD != FPC::NativeRealDescriptor());
@@ -2361,9 +2563,21 @@ VisMF::AsyncWriteDoit (const FabArray<FArrayBox>& mf, const std::string& mf_name
     }
 #endif
 
-    auto myfabs = std::make_shared<Vector<FArrayBox> >();
+    // The copies of the data count against AsyncOut's memory budget.  If
+    // it is exhausted, the job writes directly from mf, and we wait for it
+    // to finish.
+    Long nbytes_copy = 0;
     for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
         Box bx = strip_ghost ? mfi.validbox() : mfi.fabbox();
+        nbytes_copy += bx.numPts() * ncomp * sizeof(Real);
+    }
+    const bool write_sync = ! AsyncOut::Reserve(nbytes_copy);
+    if (write_sync) { nbytes_copy = 0; }
+    const FabArray<FArrayBox>* pmf = (write_sync) ? &mf : nullptr;
+
+    auto myfabs = std::make_shared<Vector<FArrayBox> >();
+    for (MFIter mfi(mf); mfi.isValid() && ! write_sync; ++mfi) {
+        Box bx = strip_ghost ? mfi.validbox() : mfi.fabbox();
 #ifdef AMREX_USE_GPU
         if (data_on_device) {
             myfabs->emplace_back(bx, mf.nComp(), The_Pinned_Arena());
@@ -2475,23 +2689,54 @@ VisMF::AsyncWriteDoit (const FabArray<FArrayBox>& mf, const std::string& mf_name
         AsyncOut::Wait();  // Wait for my turn
 
         auto info = AsyncOut::GetWriteInfo(myproc);
-        if (! myfabs->empty()) {
+        if (n_local_fabs > 0) {
             std::string file_name = amrex::Concatenate(mf_name + FabFileSuffix, info.ifile, 5);
             std::ofstream ofs;
             ofs.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
             ofs.open(file_name.c_str(), (info.ispot == 0) ? (std::ios::binary | std::ios::trunc)
                                                           : (std::ios::binary | std::ios::app));
             if (!ofs.good()) amrex::FileOpenFailed(file_name);
-            for (auto const& fab : *myfabs) {
-                fabio->write_header(ofs, fab, fab.nComp());
-                fabio->write(ofs, fab, 0, fab.nComp());
+            if (pmf) {
+                for (MFIter mfi(*pmf); mfi.isValid(); ++mfi) {
+                    FArrayBox const& fab = (*pmf)[mfi];
+                    FArrayBox tmp_fab;
+                    bool need_tmp = strip_ghost;
+#ifdef AMREX_USE_GPU
+                    need_tmp = need_tmp || data_on_device;
+#endif
+                    if (need_tmp) {
+                        Box bx = strip_ghost ? mfi.validbox() : mfi.fabbox();
+                        tmp_fab.resize(bx, ncomp, The_Pinned_Arena());
+#ifdef AMREX_USE_GPU
+                        if (data_on_device) {
+                            tmp_fab.copy<RunOn::Device>(fab, bx);
+                            Gpu::streamSynchronize();
+                        } else
+#endif
+                        {
+                            tmp_fab.copy<RunOn::Host>(fab, bx);
+                        }
+                    }
+                    FArrayBox const& wfab = (need_tmp) ? tmp_fab : fab;
+                    fabio->write_header(ofs, wfab, wfab.nComp());
+                    fabio->write(ofs, wfab, 0, wfab.nComp());
+                }
+            } else {
+                for (auto const& fab : *myfabs) {
+                    fabio->write_header(ofs, fab, fab.nComp());
+                    fabio->write(ofs, fab, 0, fab.nComp());
+                }
             }
             ofs.flush();
             ofs.close();
         }
 
         AsyncOut::Notify();  // Notify others I am done
-    });
+    }, nbytes_copy);
+
+    if (write_sync) {
+        AsyncOut::Finish();
+    }
 }
 
 }
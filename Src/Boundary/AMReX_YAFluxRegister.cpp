@@ -347,6 +347,16 @@ YAFluxRegister::FineAdd (const MFIter& mfi,
 void
 YAFluxRegister::Reflux (MultiFab& state, int dc)
 {
+    Reflux_nowait(state, dc);
+    Reflux_finish();
+}
+
+void
+YAFluxRegister::Reflux_nowait (MultiFab& state, int dc)
+{
+    AMREX_ASSERT_WITH_MESSAGE(m_reflux_state == nullptr,
+                              "YAFluxRegister::Reflux_nowait: Reflux already in progress");
+
     if (!m_cfp_mask.empty())
     {
         const int ncomp = m_ncomp;
@@ -365,10 +375,23 @@ YAFluxRegister::Reflux (MultiFab& state, int dc)
         }
     }
 
-    m_crse_data.ParallelCopy(m_cfpatch, m_crse_geom.periodicity(), FabArrayBase::ADD);
+    m_crse_data.ParallelCopy_nowait(m_cfpatch, m_crse_geom.periodicity(), FabArrayBase::ADD);
+
+    m_reflux_state = &state;
+    m_reflux_dc = dc;
+}
+
+void
+YAFluxRegister::Reflux_finish ()
+{
+    if (m_reflux_state == nullptr) { return; }
+
+    m_crse_data.ParallelCopy_finish();
+
+    BL_ASSERT(m_reflux_state->nComp() >= m_reflux_dc + m_ncomp);
+    MultiFab::Add(*m_reflux_state, m_crse_data, 0, m_reflux_dc, m_ncomp, 0);
 
-    BL_ASSERT(state.nComp() >= dc + m_ncomp);
-    MultiFab::Add(state, m_crse_data, 0, dc, m_ncomp, 0);
+    m_reflux_state = nullptr;
 }
 
 }
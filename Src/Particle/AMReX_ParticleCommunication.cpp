@@ -1,5 +1,8 @@
 #include <AMReX_ParticleCommunication.H>
 #include <AMReX_ParallelDescriptor.H>
+#include <AMReX_ParallelReduce.H>
+
+#include <numeric>
 
 using namespace amrex;
 
@@ -31,6 +34,17 @@ void ParticleCopyOp::resize (const int gid, const int lev, const int size)
     m_periodic_shift[lev][gid].resize(size);
 }
 
+void ParticleCopyOp::resetSizes ()
+{
+    for (int lev = 0; lev < m_boxes.size(); ++lev)
+    {
+        for (auto& kv : m_boxes[lev]) { kv.second.resize(0); }
+        for (auto& kv : m_levels[lev]) { kv.second.resize(0); }
+        for (auto& kv : m_src_indices[lev]) { kv.second.resize(0); }
+        for (auto& kv : m_periodic_shift[lev]) { kv.second.resize(0); }
+    }
+}
+
 void ParticleCopyPlan::clear ()
 {
     m_dst_indices.clear();
@@ -45,17 +59,75 @@ void ParticleCopyPlan::clear ()
     m_rcv_box_levs.clear();
 }
 
-void ParticleCopyPlan::buildMPIStart (const ParticleBufferMap& map, Long psize)
+struct ParticleCopyPlan::LocalHandShake
+{
+#ifdef AMREX_USE_MPI
+    MPI_Comm comm = MPI_COMM_NULL;
+    Vector<int> neighbor_procs;
+    Vector<int> procs;
+    Vector<Long> snds;
+    Vector<Long> rcvs;
+    Vector<MPI_Request> reqs;
+    Vector<MPI_Status> stats;
+
+    ~LocalHandShake ()
+    {
+        int finalized = 0;
+        MPI_Finalized(&finalized);
+        if (finalized) return;
+        for (auto& req : reqs) { MPI_Request_free(&req); }
+    }
+#endif
+};
+
+bool ParticleCopyPlan::sendsBeyondNeighbors (const ParticleBufferMap& map) const
+{
+    const int NProcs = ParallelContext::NProcsSub();
+    Vector<char> is_neighbor(NProcs, 0);
+    for (auto i : m_neighbor_procs) { is_neighbor[i] = 1; }
+
+    for (int bucket = 0, N = map.numBuckets(); bucket < N; ++bucket)
+    {
+        if (m_box_counts_h[bucket] == 0) continue;
+        int dst = map.bucketToGrid(bucket);
+        int lev = map.bucketToLevel(bucket);
+        if (! is_neighbor[map.procID(dst, lev)]) return true;
+    }
+    return false;
+}
+
+void ParticleCopyPlan::buildMPIStart (const ParticleBufferMap& map, Long psize, bool check_local)
 {
     BL_PROFILE("ParticleCopyPlan::buildMPIStart");
 
 #ifdef AMREX_USE_MPI
     const int NProcs = ParallelContext::NProcsSub();
     const int MyProc = ParallelContext::MyProcSub();
-    const int NNeighborProcs = m_neighbor_procs.size();
 
     if (NProcs == 1) return;
 
+    if (m_local)
+    {
+        // Rebuilding the persistent handshake requests draws a new SeqNum,
+        // which every proc has to do together, so the decision is reduced
+        // along with the fallback check rather than made by each proc.
+        int flags[2] = { check_local && sendsBeyondNeighbors(map),
+                         localHandShakeStale() };
+        ParallelAllReduce::Max(flags, 2, ParallelContext::CommunicatorSub());
+        if (flags[0])
+        {
+            m_local = false;
+            m_neighbor_procs.resize(NProcs);
+            std::iota(m_neighbor_procs.begin(), m_neighbor_procs.end(), 0);
+        }
+        else if (flags[1])
+        {
+            m_local_handshake.reset();
+        }
+    }
+
+    const int NNeighborProcs = m_neighbor_procs.size();
+
     m_Snds.resize(0);
     m_Snds.resize(NProcs, 0);
 
@@ -68,6 +140,11 @@ void ParticleCopyPlan::buildMPIStart (const ParticleBufferMap& map, Long psize)
     m_rcv_num_particles.resize(0);
     m_rcv_num_particles.resize(NProcs, 0);
 
+    // A plan may be reused, so do not leave the offsets of the last build
+    // around if there turns out to be no communication this time.
+    m_snd_counts.resize(0);
+    m_snd_offsets.resize(0);
+
     std::map<int, Vector<int> > snd_data;
 
     m_NumSnds = 0;
@@ -199,7 +276,7 @@ void ParticleCopyPlan::buildMPIStart (const ParticleBufferMap& map, Long psize)
     Gpu::copy(Gpu::hostToDevice, m_snd_pad_correction_h.begin(), m_snd_pad_correction_h.end(),
               m_snd_pad_correction_d.begin());
 #else
-    amrex::ignore_unused(map,psize);
+    amrex::ignore_unused(map,psize,check_local);
 #endif
 }
 
@@ -262,44 +339,73 @@ void ParticleCopyPlan::doHandShake (const Vector<Long>& Snds, Vector<Long>& Rcvs
 void ParticleCopyPlan::doHandShakeLocal (const Vector<Long>& Snds, Vector<Long>& Rcvs) const
 {
 #ifdef AMREX_USE_MPI
-    const int SeqNum = ParallelDescriptor::SeqNum();
-    const int num_rcvs = m_neighbor_procs.size();
-    Vector<MPI_Status>  stats(num_rcvs);
-    Vector<MPI_Request> rreqs(num_rcvs);
+    MPI_Comm comm = ParallelContext::CommunicatorSub();
 
-    // Post receives
-    for (int i = 0; i < num_rcvs; ++i)
+    // buildMPIStart has already reset a stale handshake on every proc.
+    if (m_local_handshake == nullptr)
     {
-        const int Who = m_neighbor_procs[i];
-        const Long Cnt = 1;
+        BL_PROFILE("ParticleCopyPlan::doHandShakeLocal::init");
 
-        AMREX_ASSERT(Who >= 0 && Who < ParallelContext::NProcsSub());
+        m_local_handshake = std::make_shared<LocalHandShake>();
+        auto& hs = *m_local_handshake;
+        hs.comm = comm;
+        hs.neighbor_procs = m_neighbor_procs;
+        for (auto i : m_neighbor_procs)
+        {
+            if (i != ParallelContext::MyProcSub()) hs.procs.push_back(i);
+        }
 
-        rreqs[i] = ParallelDescriptor::Arecv(&Rcvs[Who], Cnt, Who, SeqNum,
-                                             ParallelContext::CommunicatorSub()).req();
-    }
+        const int SeqNum = ParallelDescriptor::SeqNum();
+        const int num_procs = hs.procs.size();
+        hs.snds.resize(num_procs, 0);
+        hs.rcvs.resize(num_procs, 0);
+        hs.reqs.resize(2*num_procs);
+        hs.stats.resize(2*num_procs);
+        for (int i = 0; i < num_procs; ++i)
+        {
+            const int Who = hs.procs[i];
 
-    // Send.
-    for (int i = 0; i < num_rcvs; ++i)
-    {
-        const int Who = m_neighbor_procs[i];
-        const Long Cnt = 1;
+            AMREX_ASSERT(Who >= 0 && Who < ParallelContext::NProcsSub());
 
-        AMREX_ASSERT(Who >= 0 && Who < ParallelContext::NProcsSub());
+            MPI_Recv_init(&hs.rcvs[i], 1, ParallelDescriptor::Mpi_typemap<Long>::type(),
+                          Who, SeqNum, comm, &hs.reqs[i]);
+            MPI_Send_init(&hs.snds[i], 1, ParallelDescriptor::Mpi_typemap<Long>::type(),
+                          Who, SeqNum, comm, &hs.reqs[num_procs+i]);
+        }
+    }
 
-        ParallelDescriptor::Send(&Snds[Who], Cnt, Who, SeqNum,
-                                 ParallelContext::CommunicatorSub());
+    auto& hs = *m_local_handshake;
+    const int num_procs = hs.procs.size();
+    if (num_procs == 0) return;
+
+    for (int i = 0; i < num_procs; ++i)
+    {
+        hs.snds[i] = Snds[hs.procs[i]];
     }
 
-    if (num_rcvs > 0)
+    MPI_Startall(2*num_procs, hs.reqs.data());
+    MPI_Waitall(2*num_procs, hs.reqs.data(), hs.stats.data());
+
+    for (int i = 0; i < num_procs; ++i)
     {
-        ParallelDescriptor::Waitall(rreqs, stats);
+        Rcvs[hs.procs[i]] = hs.rcvs[i];
     }
 #else
     amrex::ignore_unused(Snds,Rcvs);
 #endif
 }
 
+bool ParticleCopyPlan::localHandShakeStale () const
+{
+#ifdef AMREX_USE_MPI
+    return m_local_handshake == nullptr ||
+        m_local_handshake->comm != ParallelContext::CommunicatorSub() ||
+        m_local_handshake->neighbor_procs != m_neighbor_procs;
+#else
+    return false;
+#endif
+}
+
 void ParticleCopyPlan::doHandShakeAllToAll (const Vector<Long>& Snds, Vector<Long>& Rcvs) const
 {
 #ifdef AMREX_USE_MPI
@@ -10,6 +10,7 @@ using namespace amrex;
 bool    ParticleContainerBase::do_tiling = false;
 IntVect ParticleContainerBase::tile_size { AMREX_D_DECL(1024000,8,8) };
 bool    ParticleContainerBase::memEfficientSort = true;
+bool    ParticleContainerBase::planRedistributeOnCPU = true;
 
 void ParticleContainerBase::Define (const Geometry            & geom,
                                     const DistributionMapping & dmap,
@@ -108,6 +109,17 @@ const std::string& ParticleContainerBase::Version ()
     return version;
 }
 
+const std::string& ParticleContainerBase::CollectiveVersion ()
+{
+    //
+    // Version string of the shared-file format written by CheckpointCollective.
+    // Older readers reject it as an unknown version instead of misreading it.
+    //
+    static const std::string version("Collective_Version_One_Dot_Zero");
+
+    return version;
+}
+
 const std::string& ParticleContainerBase::DataPrefix ()
 {
     //
@@ -258,3 +270,29 @@ void ParticleContainerBase::BuildRedistributeMask (int lev, int nghost) const
         RemoveDuplicates(neighbor_procs);
     }
 }
+
+const Vector<int>& ParticleContainerBase::NeighborProcs (int ngrow) const
+{
+    const int num_levels = this->finestLevel()+1;
+    bool valid = (ngrow == m_neighbor_procs_ngrow) && (num_levels == m_neighbor_procs_ba.size());
+    for (int lev = 0; valid && lev < num_levels; ++lev)
+    {
+        valid = BoxArray::SameRefs(m_neighbor_procs_ba[lev], this->ParticleBoxArray(lev)) &&
+            DistributionMapping::SameRefs(m_neighbor_procs_dm[lev], this->ParticleDistributionMap(lev));
+    }
+
+    if (! valid)
+    {
+        m_neighbor_procs_cache = computeNeighborProcs(this->GetParGDB(), ngrow);
+        m_neighbor_procs_ngrow = ngrow;
+        m_neighbor_procs_ba.resize(num_levels);
+        m_neighbor_procs_dm.resize(num_levels);
+        for (int lev = 0; lev < num_levels; ++lev)
+        {
+            m_neighbor_procs_ba[lev] = this->ParticleBoxArray(lev);
+            m_neighbor_procs_dm[lev] = this->ParticleDistributionMap(lev);
+        }
+    }
+
+    return m_neighbor_procs_cache;
+}
@@ -1,8 +1,12 @@
 #include <AMReX_ParticleMPIUtil.H>
 
 #include <AMReX_ParallelDescriptor.H>
+#include <AMReX_ParallelContext.H>
 #include <AMReX_ParallelReduce.H>
 #include <AMReX_BLProfiler.H>
+#include <AMReX_Utility.H>
+
+#include <algorithm>
 
 namespace amrex {
 
@@ -94,4 +98,126 @@ namespace amrex {
     }
 #endif  // AMREX_USE_MPI
 
+    Long particleExclusiveScan (Long n, Long& total)
+    {
+        total = n;
+        Long offset = 0;
+#ifdef AMREX_USE_MPI
+        if (ParallelContext::NProcsSub() > 1)
+        {
+            MPI_Comm comm = ParallelContext::CommunicatorSub();
+            BL_MPI_REQUIRE( MPI_Exscan(&n, &offset, 1, ParallelDescriptor::Mpi_typemap<Long>::type(),
+                                       MPI_SUM, comm) );
+            // MPI_Exscan leaves the result on rank 0 undefined
+            if (ParallelContext::MyProcSub() == 0) offset = 0;
+            ParallelAllReduce::Sum(total, comm);
+        }
+#endif
+        return offset;
+    }
+
+    namespace {
+        // Largest transfer handed to a single MPI-IO call, so that the
+        // byte count always fits in an int.
+        constexpr Long shared_file_chunk = Long(1) << 30;
+    }
+
+#ifdef AMREX_USE_MPI
+
+    ParticleSharedFile::ParticleSharedFile (const std::string& filename, bool for_writing)
+        : m_name(filename)
+    {
+        MPI_Comm comm = ParallelContext::CommunicatorSub();
+        const int amode = for_writing ? (MPI_MODE_CREATE | MPI_MODE_WRONLY) : MPI_MODE_RDONLY;
+        if (MPI_File_open(comm, const_cast<char*>(m_name.c_str()), amode,
+                          MPI_INFO_NULL, &m_fh) != MPI_SUCCESS) {
+            amrex::FileOpenFailed(m_name);
+        }
+        if (for_writing) {
+            BL_MPI_REQUIRE( MPI_File_set_size(m_fh, 0) );
+        }
+    }
+
+    ParticleSharedFile::~ParticleSharedFile ()
+    {
+        MPI_File_close(&m_fh);
+    }
+
+    void ParticleSharedFile::writeAt (Long offset, const void* data, Long nbytes)
+    {
+        BL_PROFILE("ParticleSharedFile::writeAt()");
+        Long nchunks = (nbytes + shared_file_chunk - 1) / shared_file_chunk;
+        ParallelAllReduce::Max(nchunks, ParallelContext::CommunicatorSub());
+        const char* p = static_cast<const char*>(data);
+        for (Long ichunk = 0; ichunk < nchunks; ++ichunk)
+        {
+            const Long start = std::min(nbytes, ichunk*shared_file_chunk);
+            const Long n = std::min(shared_file_chunk, nbytes - start);
+            MPI_Status status;
+            BL_MPI_REQUIRE( MPI_File_write_at_all(m_fh, offset + start, const_cast<char*>(p) + start,
+                                                  static_cast<int>(n), MPI_BYTE, &status) );
+        }
+    }
+
+    void ParticleSharedFile::readAt (Long offset, void* data, Long nbytes)
+    {
+        BL_PROFILE("ParticleSharedFile::readAt()");
+        Long nchunks = (nbytes + shared_file_chunk - 1) / shared_file_chunk;
+        ParallelAllReduce::Max(nchunks, ParallelContext::CommunicatorSub());
+        char* p = static_cast<char*>(data);
+        for (Long ichunk = 0; ichunk < nchunks; ++ichunk)
+        {
+            const Long start = std::min(nbytes, ichunk*shared_file_chunk);
+            const Long n = std::min(shared_file_chunk, nbytes - start);
+            MPI_Status status;
+            BL_MPI_REQUIRE( MPI_File_read_at_all(m_fh, offset + start, p + start,
+                                                 static_cast<int>(n), MPI_BYTE, &status) );
+            int nread = 0;
+            MPI_Get_count(&status, MPI_BYTE, &nread);
+            if (nread != n) {
+                amrex::Abort("ParticleSharedFile::readAt(): short read from " + m_name);
+            }
+        }
+    }
+
+#else
+
+    ParticleSharedFile::ParticleSharedFile (const std::string& filename, bool for_writing)
+        : m_name(filename)
+    {
+        const auto mode = for_writing ? (std::ios::out | std::ios::trunc | std::ios::binary)
+                                      : (std::ios::in | std::ios::binary);
+        m_fs.open(m_name.c_str(), mode);
+        if ( ! m_fs.good()) amrex::FileOpenFailed(m_name);
+    }
+
+    ParticleSharedFile::~ParticleSharedFile ()
+    {
+        m_fs.close();
+    }
+
+    void ParticleSharedFile::writeAt (Long offset, const void* data, Long nbytes)
+    {
+        BL_PROFILE("ParticleSharedFile::writeAt()");
+        if (nbytes <= 0) return;
+        m_fs.seekp(offset, std::ios::beg);
+        m_fs.write(static_cast<const char*>(data), nbytes);
+        if ( ! m_fs.good()) {
+            amrex::Abort("ParticleSharedFile::writeAt(): problem writing " + m_name);
+        }
+    }
+
+    void ParticleSharedFile::readAt (Long offset, void* data, Long nbytes)
+    {
+        BL_PROFILE("ParticleSharedFile::readAt()");
+        if (nbytes <= 0) return;
+        m_fs.seekg(offset, std::ios::beg);
+        m_fs.read(static_cast<char*>(data), nbytes);
+        if ( ! m_fs.good()) {
+            amrex::Abort("ParticleSharedFile::readAt(): short read from " + m_name);
+        }
+    }
+
+#endif  // AMREX_USE_MPI
+
 }
@@ -0,0 +1,138 @@
+#include <AMReX_ParticleMemoryPool.H>
+#include <AMReX.H>
+#include <AMReX_Arena.H>
+#include <AMReX_ParmParse.H>
+
+#include <array>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace amrex {
+
+namespace {
+
+    constexpr int min_size_class = 6; // 64 bytes
+    constexpr int num_size_classes = 64;
+
+    std::mutex pool_mutex;
+    std::array<std::vector<void*>, num_size_classes> free_lists;
+    std::unordered_map<void*, int> live_blocks;
+    ParticleMemoryPool::Stats pool_stats;
+    Long max_cached_bytes = Long(256)*1024*1024;
+    bool max_cached_bytes_set = false; // by setMaxCachedBytes, which wins over ParmParse
+    // Set by the first alloc, cleared by release.  While it is false,
+    // freed blocks go straight back to The_Arena.
+    bool pool_open = false;
+
+    int sizeClass (std::size_t nbytes)
+    {
+        int k = min_size_class;
+        while ((std::size_t(1) << k) < nbytes) ++k;
+        return k;
+    }
+
+    // Return cached blocks to The_Arena, largest first, until at most
+    // max_bytes are cached.  Must be called with pool_mutex held.
+    void trimCache (Long max_bytes)
+    {
+        for (int k = num_size_classes-1; k >= min_size_class; --k)
+        {
+            const auto block_size = static_cast<Long>(std::size_t(1) << k);
+            auto& fl = free_lists[k];
+            while (pool_stats.bytes_cached > max_bytes && ! fl.empty()) {
+                The_Arena()->free(fl.back());
+                fl.pop_back();
+                pool_stats.bytes_cached -= block_size;
+            }
+        }
+    }
+}
+
+void*
+ParticleMemoryPool::alloc (std::size_t nbytes)
+{
+    if (nbytes == 0) return nullptr;
+
+    const int k = sizeClass(nbytes);
+    const auto block_size = static_cast<Long>(std::size_t(1) << k);
+
+    std::lock_guard<std::mutex> lock(pool_mutex);
+
+    if ( ! pool_open) {
+        if ( ! max_cached_bytes_set) {
+            ParmParse pp("particles");
+            pp.query("pool_max_cached_bytes", max_cached_bytes);
+        }
+        amrex::ExecOnFinalize(ParticleMemoryPool::release);
+        pool_open = true;
+    }
+
+    void* p;
+    auto& fl = free_lists[k];
+    if (fl.empty()) {
+        p = The_Arena()->alloc(block_size);
+        ++pool_stats.arena_allocs;
+    } else {
+        p = fl.back();
+        fl.pop_back();
+        ++pool_stats.reuses;
+        pool_stats.bytes_cached -= block_size;
+    }
+
+    live_blocks[p] = k;
+    pool_stats.bytes_in_use += block_size;
+    return p;
+}
+
+void
+ParticleMemoryPool::free (void* ptr)
+{
+    if (ptr == nullptr) return;
+
+    std::lock_guard<std::mutex> lock(pool_mutex);
+
+    auto it = live_blocks.find(ptr);
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(it != live_blocks.end(),
+                                     "ParticleMemoryPool::free: pointer was not allocated by the pool");
+    const int k = it->second;
+    live_blocks.erase(it);
+
+    const auto block_size = static_cast<Long>(std::size_t(1) << k);
+    pool_stats.bytes_in_use -= block_size;
+    if (pool_open && pool_stats.bytes_cached + block_size <= max_cached_bytes) {
+        free_lists[k].push_back(ptr);
+        pool_stats.bytes_cached += block_size;
+    } else {
+        The_Arena()->free(ptr);
+    }
+}
+
+void
+ParticleMemoryPool::release ()
+{
+    std::lock_guard<std::mutex> lock(pool_mutex);
+
+    trimCache(0);
+
+    // amrex::Finalize runs this, and a later amrex::Initialize needs it registered again.
+    pool_open = false;
+}
+
+void
+ParticleMemoryPool::setMaxCachedBytes (Long max_bytes)
+{
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    max_cached_bytes = max_bytes;
+    max_cached_bytes_set = true;
+    trimCache(max_cached_bytes);
+}
+
+ParticleMemoryPool::Stats
+ParticleMemoryPool::stats ()
+{
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    return pool_stats;
+}
+
+}
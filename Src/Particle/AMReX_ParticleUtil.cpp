@@ -1,4 +1,9 @@
 #include <AMReX_ParticleUtil.H>
+#include <AMReX_Morton.H>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
 
 namespace amrex
 {
@@ -19,6 +24,103 @@ IntVect computeRefFac (const ParGDBBase* a_gdb, int src_lev, int lev)
     return ref_fac;
 }
 
+namespace
+{
+    // Index along a Hilbert curve of a cell with nbits bits per direction,
+    // after J. Skilling, "Programming the Hilbert curve" (2004).
+    std::uint64_t hilbertIndex (const IntVect& iv, int nbits)
+    {
+        std::uint32_t X[AMREX_SPACEDIM];
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            X[idim] = static_cast<std::uint32_t>(iv[idim]);
+        }
+
+        // Inverse undo excess work
+        const std::uint32_t M = 1u << (nbits-1);
+        for (std::uint32_t Q = M; Q > 1; Q >>= 1) {
+            const std::uint32_t P = Q - 1;
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                if (X[idim] & Q) {
+                    X[0] ^= P;
+                } else {
+                    const std::uint32_t t = (X[0] ^ X[idim]) & P;
+                    X[0] ^= t;
+                    X[idim] ^= t;
+                }
+            }
+        }
+
+        // Gray encode
+        for (int idim = 1; idim < AMREX_SPACEDIM; ++idim) {
+            X[idim] ^= X[idim-1];
+        }
+        std::uint32_t t = 0;
+        for (std::uint32_t Q = M; Q > 1; Q >>= 1) {
+            if (X[AMREX_SPACEDIM-1] & Q) t ^= Q - 1;
+        }
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            X[idim] ^= t;
+        }
+
+        // Interleave the transposed bits, most significant first
+        std::uint64_t h = 0;
+        for (int b = nbits-1; b >= 0; --b) {
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                h = (h << 1) | ((X[idim] >> b) & 1u);
+            }
+        }
+        return h;
+    }
+
+    std::uint64_t mortonIndex (const IntVect& iv)
+    {
+        return AMREX_D_TERM( Morton::makeSpace(iv[0]),
+                           | (Morton::makeSpace(iv[1]) << 1),
+                           | (Morton::makeSpace(iv[2]) << 2));
+    }
+}
+
+void computeCurveOrder (const IntVect& len, ParticleSortCurve curve,
+                        Gpu::DeviceVector<unsigned int>& order)
+{
+    BL_PROFILE("amrex::computeCurveOrder");
+
+    const Box box(IntVect::TheZeroVector(), len - 1);
+    const Long ncells = box.numPts();
+
+    int nbits = 1;
+    while ((1 << nbits) < len.max()) { ++nbits; }
+
+    if (curve == ParticleSortCurve::Morton) {
+        constexpr int max_bits = (AMREX_SPACEDIM == 3) ? 10 : ((AMREX_SPACEDIM == 2) ? 16 : 31);
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(nbits <= max_bits,
+                                         "computeCurveOrder: box too long for a 32-bit Morton code");
+    } else {
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(nbits*AMREX_SPACEDIM <= 64,
+                                         "computeCurveOrder: box too long for a 64-bit Hilbert code");
+    }
+
+    Vector<std::uint64_t> codes(ncells);
+    for (Long i = 0; i < ncells; ++i) {
+        const IntVect iv = box.atOffset(i);
+        codes[i] = (curve == ParticleSortCurve::Morton) ? mortonIndex(iv)
+                                                        : hilbertIndex(iv, nbits);
+    }
+
+    Vector<unsigned int> cells(ncells);
+    std::iota(cells.begin(), cells.end(), 0u);
+    std::sort(cells.begin(), cells.end(),
+              [&] (unsigned int a, unsigned int b) { return codes[a] < codes[b]; });
+
+    Gpu::HostVector<unsigned int> h_order(ncells);
+    for (Long i = 0; i < ncells; ++i) {
+        h_order[cells[i]] = static_cast<unsigned int>(i);
+    }
+
+    order.resize(ncells);
+    Gpu::copy(Gpu::hostToDevice, h_order.begin(), h_order.end(), order.begin());
+}
+
 Vector<int> computeNeighborProcs (const ParGDBBase* a_gdb, int ngrow)
 {
     BL_PROFILE("amrex::computeNeighborProcs");
@@ -13,6 +13,9 @@ using namespace amrex;
 int      AmrLevelAdv::verbose         = 0;
 Real     AmrLevelAdv::cfl             = 0.9;
 int      AmrLevelAdv::do_reflux       = 1;
+int      AmrLevelAdv::check_fillpatch = 0;
+int      AmrLevelAdv::check_derive_cache = 0;
+int      AmrLevelAdv::check_reflux_group = 0;
 
 int      AmrLevelAdv::NUM_STATE       = 1;  // One variable in the state
 int      AmrLevelAdv::NUM_GROW        = 3;  // number of ghost cells
@@ -287,6 +290,10 @@ AmrLevelAdv::advance (Real time,
     MultiFab Sborder(grids, dmap, NUM_STATE, NUM_GROW);
     FillPatch(*this, Sborder, NUM_GROW, time, Phi_Type, 0, NUM_STATE);
 
+    if (check_fillpatch) {
+        checkFillPatch(Sborder, time);
+    }
+
     // MF to hold the mac velocity
     MultiFab Umac[BL_SPACEDIM];
     for (int i = 0; i < BL_SPACEDIM; i++) {
@@ -603,6 +610,9 @@ AmrLevelAdv::post_timestep (int iteration)
     if (level < finest_level)
         avgDown();
 
+    if (check_derive_cache)
+        checkDeriveCache();
+
 #ifdef AMREX_PARTICLES
     if (TracerPC)
       {
@@ -739,6 +749,9 @@ AmrLevelAdv::read_params ()
     pp.query("v",verbose);
     pp.query("cfl",cfl);
     pp.query("do_reflux",do_reflux);
+    pp.query("check_fillpatch",check_fillpatch);
+    pp.query("check_derive_cache",check_derive_cache);
+    pp.query("check_reflux_group",check_reflux_group);
 
     Geometry const* gg = AMReX::top()->getDefaultGeometry();
 
@@ -762,6 +775,85 @@ AmrLevelAdv::read_params ()
 }
 
 
+/**
+ * Check that the FillPatch for several state types at once gives the same
+ * result as one FillPatch per state type.
+ */
+void
+AmrLevelAdv::checkFillPatch (const MultiFab& Sborder, Real time)
+{
+    MultiFab S1(grids, dmap, NUM_STATE, NUM_GROW);
+    MultiFab S2(grids, dmap, 2*NUM_STATE, NUM_GROW);
+    FillPatch(*this, {&S1, &S2, &S2}, NUM_GROW, time,
+              {Phi_Type, Phi_Type, Phi_Type}, {0, 0, 0},
+              {NUM_STATE, NUM_STATE, NUM_STATE}, {0, 0, NUM_STATE});
+
+    const Vector<std::pair<MultiFab*,int> > results{{&S1,0}, {&S2,0}, {&S2,NUM_STATE}};
+    for (auto const& r : results) {
+        MultiFab::Subtract(*r.first, Sborder, 0, r.second, NUM_STATE, NUM_GROW);
+        for (int n = 0; n < NUM_STATE; ++n) {
+            if (r.first->norm0(r.second+n, NUM_GROW) != 0.0) {
+                amrex::Abort("AmrLevelAdv::checkFillPatch: the multi-state FillPatch differs at level "
+                             + std::to_string(level));
+            }
+        }
+    }
+}
+
+// Change the state without changing its time and check that derive sees it.
+void
+AmrLevelAdv::checkDeriveCache ()
+{
+    const Real time = state[Phi_Type].curTime();
+    auto before = derive("phi", time, 0);
+
+    get_new_data(Phi_Type).plus(1.0, 0, 1, 0);
+    auto after = derive("phi", time, 0);
+    get_new_data(Phi_Type).plus(-1.0, 0, 1, 0);
+
+    MultiFab::Subtract(*after, *before, 0, 0, 1, 0);
+    after->plus(-1.0, 0, 1, 0);
+    if (after->norm0(0) > 1.e-12) {
+        amrex::Abort("AmrLevelAdv::checkDeriveCache: derive returned stale data at level "
+                     + std::to_string(level));
+    }
+}
+
+// Reflux copies of the state of this level, and of the next finer level if
+// it has a finer level too, with FluxRegisterGroup and one after another,
+// and check that the results agree.
+void
+AmrLevelAdv::checkRefluxGroup ()
+{
+    const int nlevs = std::min(level+2, parent->finestLevel()) - level;
+
+    Vector<MultiFab> S_seq(nlevs);
+    Vector<MultiFab> S_grp(nlevs);
+    FluxRegisterGroup group;
+    for (int i = 0; i < nlevs; ++i) {
+        AmrLevelAdv& amrlev = getLevel(level+i);
+        const MultiFab& S = amrlev.get_new_data(Phi_Type);
+        S_seq[i].define(S.boxArray(), S.DistributionMap(), NUM_STATE, 0);
+        S_grp[i].define(S.boxArray(), S.DistributionMap(), NUM_STATE, 0);
+        MultiFab::Copy(S_seq[i], S, 0, 0, NUM_STATE, 0);
+        MultiFab::Copy(S_grp[i], S, 0, 0, NUM_STATE, 0);
+
+        getFluxReg(level+i+1).Reflux(S_seq[i], 1.0, 0, 0, NUM_STATE, amrlev.Geom());
+        group.add(getFluxReg(level+i+1), S_grp[i], 1.0, 0, 0, NUM_STATE, amrlev.Geom());
+    }
+    group.Reflux();
+
+    for (int i = 0; i < nlevs; ++i) {
+        MultiFab::Subtract(S_grp[i], S_seq[i], 0, 0, NUM_STATE, 0);
+        for (int n = 0; n < NUM_STATE; ++n) {
+            if (S_grp[i].norm0(n) != 0.0) {
+                amrex::Abort("AmrLevelAdv::checkRefluxGroup: FluxRegisterGroup differs at level "
+                             + std::to_string(level+i));
+            }
+        }
+    }
+}
+
 void
 AmrLevelAdv::reflux ()
 {
@@ -769,6 +861,10 @@ AmrLevelAdv::reflux ()
 
     const auto strt = amrex::second();
 
+    if (check_reflux_group) {
+        checkRefluxGroup();
+    }
+
     getFluxReg(level+1).Reflux(get_new_data(Phi_Type),1.0,0,0,NUM_STATE,geom);
 
     if (verbose)
@@ -1,6 +1,7 @@
 #include <AMReX.H>
 #include <AMReX_MultiFab.H>
 #include <AMReX_VisMF.H>
+#include <AMReX_PlotFileUtil.H>
 #include <AMReX_ParmParse.H>
 #include <AMReX_BLProfiler.H>
 
@@ -206,4 +207,47 @@ void main_main ()
         }
     }
     ParallelDescriptor::Barrier();
+
+// ***************************************************************
+
+    amrex::Print() << " Check AsyncOut data " << std::endl;
+    for (int m = 0; m < nwrites; ++m) {
+        MultiFab mf_read(mfs[m].boxArray(), mfs[m].DistributionMap(), mfs[m].nComp(), 0);
+        VisMF::Read(mf_read, std::string("vismfdata/file-" + std::to_string(m)));
+        MultiFab::Subtract(mf_read, mfs[m], 0, 0, mfs[m].nComp(), 0);
+        if (mf_read.norm0() != 0.0) {
+            amrex::Abort("AsyncOut data do not match: vismfdata/file-" + std::to_string(m));
+        }
+    }
+
+// ***************************************************************
+
+    // Each plotfile submits a header job on one process only and a
+    // collective data job on all of them, so this checks that the
+    // collective jobs still run on the same writer thread everywhere.
+    amrex::Print() << " AsyncOut plotfiles " << std::endl;
+    {
+        BL_PROFILE_REGION("plotfile-async");
+        Geometry geom(ba.minimalBox(), RealBox(AMREX_D_DECL(0.,0.,0.),
+                                               AMREX_D_DECL(1.,1.,1.)),
+                      0, Array<int,AMREX_SPACEDIM>{AMREX_D_DECL(0,0,0)});
+        for (int m = 0; m < nwrites; ++m) {
+            WriteSingleLevelPlotfile(std::string("vismfdata/plt-" + std::to_string(m)),
+                                     mfs[m], {"phi"}, geom, 0., 0);
+        }
+        AsyncOut::Finish();
+    }
+    ParallelDescriptor::Barrier();
+
+    amrex::Print() << " Check AsyncOut plotfiles " << std::endl;
+    for (int m = 0; m < nwrites; ++m) {
+        const std::string name("vismfdata/plt-" + std::to_string(m));
+        PlotFileData pf(name);
+        MultiFab mf_read(mfs[m].boxArray(), mfs[m].DistributionMap(), 1, 0);
+        mf_read.ParallelCopy(pf.get(0, "phi"));
+        MultiFab::Subtract(mf_read, mfs[m], 0, 0, 1, 0);
+        if (mf_read.norm0() != 0.0) {
+            amrex::Abort("AsyncOut plotfile data do not match: " + name);
+        }
+    }
 }
@@ -0,0 +1,121 @@
+#include <AMReX.H>
+#include <AMReX_FabConv.H>
+#include <AMReX_FPC.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Print.H>
+#include <AMReX_Random.H>
+#include <AMReX_Utility.H>
+
+#include <cmath>
+#include <cstring>
+#include <string>
+
+using namespace amrex;
+
+namespace {
+
+// A descriptor with the same format as rd, but in the opposite byte order.
+RealDescriptor reversed (RealDescriptor const& rd)
+{
+    Vector<int> ord(rd.orderarray().rbegin(), rd.orderarray().rend());
+    return RealDescriptor(rd.format(), ord.data(), ord.size());
+}
+
+// Reference conversion of a single native Real to the given descriptor.
+void to_ref (char* out, Real x, int nbytes, bool swapped)
+{
+    char tmp[8];
+    if (nbytes == 4) {
+        auto y = static_cast<float>(x);
+        std::memcpy(tmp, &y, 4);
+    } else {
+        auto y = static_cast<double>(x);
+        std::memcpy(tmp, &y, 8);
+    }
+    for (int i = 0; i < nbytes; ++i) {
+        out[i] = swapped ? tmp[nbytes-1-i] : tmp[i];
+    }
+}
+
+}
+
+void testFabConv ()
+{
+    Long n = 4194304;
+    int nrep = 5;
+    {
+        ParmParse pp;
+        pp.query("n", n);
+        pp.query("nrep", nrep);
+    }
+
+    struct Case {
+        std::string name;
+        RealDescriptor rd;
+        bool swapped;
+    };
+    Vector<Case> cases{{"native 32", FPC::Native32RealDescriptor(), false},
+                       {"swapped 32", reversed(FPC::Native32RealDescriptor()), true},
+                       {"native 64", FPC::Native64RealDescriptor(), false},
+                       {"swapped 64", reversed(FPC::Native64RealDescriptor()), true}};
+
+    Vector<Real> native(n);
+    for (Long i = 0; i < n; ++i) {
+        // Values of both signs spanning many decades, all representable
+        // as normal floats.
+        Real r = Real(2.0)*amrex::Random() - Real(1.0);
+        native[i] = r * std::pow(Real(10.0), Real(i%61 - 30));
+    }
+    native[0] = Real(0.0);
+    if (n > 1) { native[1] = -Real(0.0); }
+
+    Vector<Real> back(n);
+    Vector<char> ref(n*8);
+    Vector<char> buf(n*8);
+
+    for (auto const& c : cases)
+    {
+        const int nbytes = c.rd.numBytes();
+        for (Long i = 0; i < n; ++i) {
+            to_ref(ref.data()+i*nbytes, native[i], nbytes, c.swapped);
+        }
+
+        Real t_from = 0.0, t_to = 0.0;
+        for (int irep = 0; irep < nrep; ++irep)
+        {
+            Real t0 = amrex::second();
+            RealDescriptor::convertFromNativeFormat(buf.data(), n, native.data(), c.rd);
+            Real t1 = amrex::second();
+            RealDescriptor::convertToNativeFormat(back.data(), n, buf.data(), c.rd);
+            Real t2 = amrex::second();
+            t_from += t1-t0;
+            t_to   += t2-t1;
+        }
+
+        if (std::memcmp(buf.data(), ref.data(), n*nbytes) != 0) {
+            amrex::Abort("FabConv: convertFromNativeFormat to " + c.name + " is wrong");
+        }
+        for (Long i = 0; i < n; ++i) {
+            Real expected = (nbytes == 4) ? static_cast<Real>(static_cast<float>(native[i]))
+                                          : native[i];
+            if (std::memcmp(&back[i], &expected, sizeof(Real)) != 0) {
+                amrex::Abort("FabConv: convertToNativeFormat from " + c.name + " is wrong");
+            }
+        }
+
+        // Bytes read plus bytes written, in GB/s.
+        const Real gb = Real(nrep) * Real(n) * Real(nbytes + sizeof(Real)) * Real(1.e-9);
+        amrex::Print() << "  " << c.name << ": from native " << gb/t_from
+                       << " GB/s, to native " << gb/t_to << " GB/s\n";
+    }
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+
+    amrex::Print() << "Running FabConv test. \n";
+    testFabConv();
+
+    amrex::Finalize();
+}
@@ -0,0 +1,182 @@
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_iMultiFab.H>
+#include <AMReX_Particles.H>
+#include <AMReX_ParticleInterpolators.H>
+
+using namespace amrex;
+
+// the per-particle result goes to the first max_comps real components, the binned one to the rest
+static constexpr int max_comps = 5;
+
+using PC = ParticleContainer<2*max_comps, 2>;
+
+struct TestParams
+{
+    IntVect size;
+    int max_grid_size;
+    int num_particles;
+    int num_comps;
+};
+
+void get_test_params (TestParams& params, const std::string& prefix)
+{
+    ParmParse pp(prefix);
+    pp.get("size", params.size);
+    pp.get("max_grid_size", params.max_grid_size);
+    pp.get("num_particles", params.num_particles);
+    pp.get("num_comps", params.num_comps);
+    AMREX_ALWAYS_ASSERT(params.num_comps <= max_comps);
+}
+
+// fill the valid and ghost cells with values that differ from cell to cell and component to component
+template <class MF>
+void FillMesh (MF& mf)
+{
+    for (MFIter mfi(mf); mfi.isValid(); ++mfi)
+    {
+        auto arr = mf.array(mfi);
+        amrex::ParallelFor(mfi.fabbox(), mf.nComp(),
+        [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
+        {
+            arr(i,j,k,n) = static_cast<typename MF::value_type>((7*i + 13*j + 17*k + 5*n + 1000) % 11);
+        });
+    }
+}
+
+Long CountMismatches (const PC& pc, int num_comps)
+{
+    using PType = typename PC::SuperParticleType;
+    auto r = ReduceSum(pc, [=] AMREX_GPU_HOST_DEVICE (const PType& p) -> Long
+    {
+        Long n = (p.idata(0) != p.idata(1));
+        for (int comp = 0; comp < num_comps; ++comp) {
+            n += (std::abs(p.rdata(comp) - p.rdata(max_comps+comp)) > 1.e-12);
+        }
+        return n;
+    });
+    ParallelAllReduce::Sum(r, ParallelContext::CommunicatorSub());
+    return r;
+}
+
+void testBinnedMeshToParticle ()
+{
+    BL_PROFILE("testBinnedMeshToParticle");
+    TestParams params;
+    get_test_params(params, "binned");
+
+    RealBox real_box;
+    for (int n = 0; n < AMREX_SPACEDIM; n++)
+    {
+        real_box.setLo(n, 0.0);
+        real_box.setHi(n, 1.0);
+    }
+
+    IntVect domain_lo(AMREX_D_DECL(0, 0, 0));
+    IntVect domain_hi(AMREX_D_DECL(params.size[0]-1,params.size[1]-1,params.size[2]-1));
+    const Box domain(domain_lo, domain_hi);
+
+    int coord = 0;
+    int is_per[AMREX_SPACEDIM];
+    for (int i = 0; i < AMREX_SPACEDIM; i++)
+        is_per[i] = 1;
+    Geometry geom(domain, &real_box, coord, is_per);
+
+    BoxArray ba(domain);
+    ba.maxSize(params.max_grid_size);
+    DistributionMapping dm(ba);
+
+    PC pc(geom, dm, ba);
+    PC::ParticleInitData pdata = {{}, {}, {}, {}};
+    pc.InitRandom(params.num_particles, 451, pdata, false);
+
+    const int nc = params.num_comps;
+    MultiFab field(ba, dm, nc, 1);
+    FillMesh(field);
+    iMultiFab count(ba, dm, 1, 1);
+    FillMesh(count);
+
+    const auto plo = geom.ProbLoArray();
+    const auto dxi = geom.InvCellSizeArray();
+
+    auto read_mesh = [=] AMREX_GPU_DEVICE (Array4<const Real> const& arr,
+                                           int i, int j, int k, int comp)
+    {
+        return arr(i, j, k, comp);
+    };
+    auto set_real = [=] AMREX_GPU_DEVICE (PC::ParticleType& part, int comp, Real val)
+    {
+        part.rdata(comp) = val;
+    };
+    auto add_real = [=] AMREX_GPU_DEVICE (PC::ParticleType& part, int comp, Real val)
+    {
+        part.rdata(comp) += val;
+    };
+
+    // linear interpolation, one particle at a time ...
+    amrex::MeshToParticle(pc, field, 0,
+        [=] AMREX_GPU_DEVICE (PC::ParticleType& p, Array4<const Real> const& arr)
+        {
+            for (int comp = 0; comp < 2*max_comps; ++comp) { p.rdata(comp) = 0.0; }
+            ParticleInterpolator::Linear interp(p, plo, dxi);
+            interp.MeshToParticle(p, arr, 0, 0, nc, read_mesh, add_real);
+        });
+
+    // ... and one stencil at a time
+    amrex::MeshToParticleBinned<ParticleInterpolator::Linear>(pc, field, 0, 0, max_comps, nc,
+                                                              read_mesh, add_real);
+
+    // nearest grid point, with an integer mesh
+    amrex::MeshToParticle(pc, count, 0,
+        [=] AMREX_GPU_DEVICE (PC::ParticleType& p, Array4<const int> const& arr)
+        {
+            ParticleInterpolator::Nearest interp(p, plo, dxi);
+            interp.MeshToParticle(p, arr, 0, 0, 1,
+                [=] AMREX_GPU_DEVICE (Array4<const int> const& a, int i, int j, int k, int comp)
+                {
+                    return a(i, j, k, comp);
+                },
+                [=] AMREX_GPU_DEVICE (PC::ParticleType& part, int comp, int val)
+                {
+                    part.idata(comp) = val;
+                });
+        });
+
+    amrex::MeshToParticleBinned<ParticleInterpolator::Nearest>(pc, count, 0, 0, 1, 1,
+        [=] AMREX_GPU_DEVICE (Array4<const int> const& a, int i, int j, int k, int comp)
+        {
+            return a(i, j, k, comp);
+        },
+        [=] AMREX_GPU_DEVICE (PC::ParticleType& part, int comp, int val)
+        {
+            part.idata(comp) = val;
+        });
+
+    AMREX_ALWAYS_ASSERT(CountMismatches(pc, nc) == 0);
+
+    // a mesh on other grids than the particles goes through a copy first
+    BoxArray other_ba(domain);
+    other_ba.maxSize(params.max_grid_size/2);
+    DistributionMapping other_dm(other_ba);
+    MultiFab other_field(other_ba, other_dm, nc, 1);
+    other_field.ParallelCopy(field, 0, 0, nc, IntVect(1), IntVect(1));
+
+    amrex::MeshToParticleBinned<ParticleInterpolator::Nearest>(pc, field, 0, 0, 0, nc,
+                                                               read_mesh, set_real);
+    amrex::MeshToParticleBinned<ParticleInterpolator::Nearest>(pc, other_field, 0, 0, max_comps, nc,
+                                                               read_mesh, set_real);
+    AMREX_ALWAYS_ASSERT(CountMismatches(pc, nc) == 0);
+
+    amrex::Print() << "pass \n";
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+
+    amrex::Print() << "Running binned mesh to particle test \n";
+    testBinnedMeshToParticle();
+
+    amrex::Finalize();
+}
@@ -0,0 +1,172 @@
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_Particles.H>
+
+using namespace amrex;
+
+static constexpr int NSR = 2;
+static constexpr int NSI = 1;
+static constexpr int NAR = 1;
+static constexpr int NAI = 1;
+
+using PC = ParticleContainer<NSR, NSI, NAR, NAI>;
+
+struct TestParams
+{
+    IntVect size;
+    int max_grid_size;
+    int restart_max_grid_size;
+    int num_ppc;
+};
+
+void get_test_params (TestParams& params, const std::string& prefix)
+{
+    ParmParse pp(prefix);
+    pp.get("size", params.size);
+    pp.get("max_grid_size", params.max_grid_size);
+    pp.get("restart_max_grid_size", params.restart_max_grid_size);
+    pp.get("num_ppc", params.num_ppc);
+}
+
+void InitParticles (PC& pc, int num_ppc)
+{
+    const int lev = 0;
+    const auto dx = pc.Geom(lev).CellSizeArray();
+    const auto plo = pc.Geom(lev).ProbLoArray();
+
+    for (MFIter mfi = pc.MakeMFIter(lev); mfi.isValid(); ++mfi)
+    {
+        const Box& tile_box = mfi.tilebox();
+        const int np = tile_box.numPts() * num_ppc;
+
+        auto& ptile = pc.DefineAndReturnParticleTile(lev, mfi);
+        ptile.resize(np);
+        auto ptd = ptile.getParticleTileData();
+
+        const Long id_start = PC::ParticleType::NextID();
+        PC::ParticleType::NextID(id_start + np);
+        const int cpu = ParallelDescriptor::MyProc();
+
+        amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE (int i) noexcept
+        {
+            IntVect iv = tile_box.atOffset(i / num_ppc);
+            const int ip = i % num_ppc;
+            auto& p = ptd.m_aos[i];
+            for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                p.pos(d) = static_cast<ParticleReal>(plo[d] + (iv[d] + (ip+0.5)/num_ppc)*dx[d]);
+            }
+            p.id() = id_start + i;
+            p.cpu() = cpu;
+            const Long id = p.id();
+            p.rdata(0) = static_cast<ParticleReal>(id);
+            p.rdata(1) = static_cast<ParticleReal>(2*id);
+            p.idata(0) = static_cast<int>(3*id);
+            ptd.m_rdata[0][i] = static_cast<ParticleReal>(4*id);
+            ptd.m_idata[0][i] = static_cast<int>(5*id);
+        });
+    }
+    Gpu::synchronize();
+}
+
+// every component of every particle is a known multiple of its id
+Long CountMismatches (const PC& pc)
+{
+    using PType = typename PC::SuperParticleType;
+    auto r = ReduceSum(pc, [=] AMREX_GPU_HOST_DEVICE (const PType& p) -> Long
+    {
+        const Long id = p.id();
+        return (p.rdata(0) != static_cast<ParticleReal>(id)) +
+               (p.rdata(1) != static_cast<ParticleReal>(2*id)) +
+               (p.rdata(2) != static_cast<ParticleReal>(4*id)) +
+               (p.idata(0) != static_cast<int>(3*id)) +
+               (p.idata(1) != static_cast<int>(5*id));
+    });
+    ParallelAllReduce::Sum(r, ParallelContext::CommunicatorSub());
+    return r;
+}
+
+template <class F>
+Real SumOver (const PC& pc, F&& f)
+{
+    auto r = ReduceSum(pc, std::forward<F>(f));
+    ParallelAllReduce::Sum(r, ParallelContext::CommunicatorSub());
+    return r;
+}
+
+void testCollectiveIO ()
+{
+    BL_PROFILE("testCollectiveIO");
+    TestParams params;
+    get_test_params(params, "collective");
+
+    RealBox real_box;
+    for (int n = 0; n < AMREX_SPACEDIM; n++)
+    {
+        real_box.setLo(n, 0.0);
+        real_box.setHi(n, 1.0);
+    }
+
+    IntVect domain_lo(AMREX_D_DECL(0, 0, 0));
+    IntVect domain_hi(AMREX_D_DECL(params.size[0]-1,params.size[1]-1,params.size[2]-1));
+    const Box domain(domain_lo, domain_hi);
+
+    int coord = 0;
+    int is_per[AMREX_SPACEDIM];
+    for (int i = 0; i < AMREX_SPACEDIM; i++)
+        is_per[i] = 1;
+    Geometry geom(domain, &real_box, coord, is_per);
+
+    BoxArray ba(domain);
+    ba.maxSize(params.max_grid_size);
+    DistributionMapping dm(ba);
+
+    PC pc(geom, dm, ba);
+    InitParticles(pc, params.num_ppc);
+
+    const Long np_total = pc.TotalNumberOfParticles();
+    AMREX_ALWAYS_ASSERT(np_total == domain.numPts()*params.num_ppc);
+    AMREX_ALWAYS_ASSERT(CountMismatches(pc) == 0);
+
+    using PType = typename PC::SuperParticleType;
+    auto pos_sum = [=] AMREX_GPU_HOST_DEVICE (const PType& p) -> Real
+    {
+        return AMREX_D_TERM(p.pos(0), + 2*p.pos(1), + 3*p.pos(2));
+    };
+    const Real pos_ref = SumOver(pc, pos_sum);
+
+    pc.CheckpointCollective("collective_chk", "particles");
+
+    // restart onto a different set of grids, through the collective reader directly ...
+    BoxArray restart_ba(domain);
+    restart_ba.maxSize(params.restart_max_grid_size);
+    DistributionMapping restart_dm(restart_ba);
+    {
+        PC restart_pc(geom, restart_dm, restart_ba);
+        restart_pc.RestartCollective("collective_chk", "particles");
+        AMREX_ALWAYS_ASSERT(restart_pc.TotalNumberOfParticles() == np_total);
+        AMREX_ALWAYS_ASSERT(CountMismatches(restart_pc) == 0);
+        AMREX_ALWAYS_ASSERT(std::abs(SumOver(restart_pc, pos_sum) - pos_ref) <= 1.e-9*std::abs(pos_ref));
+    }
+
+    // ... and through Restart, which must recognize the format
+    {
+        PC restart_pc(geom, dm, ba);
+        restart_pc.Restart("collective_chk", "particles");
+        AMREX_ALWAYS_ASSERT(restart_pc.TotalNumberOfParticles() == np_total);
+        AMREX_ALWAYS_ASSERT(CountMismatches(restart_pc) == 0);
+        AMREX_ALWAYS_ASSERT(std::abs(SumOver(restart_pc, pos_sum) - pos_ref) <= 1.e-9*std::abs(pos_ref));
+    }
+
+    amrex::Print() << "pass \n";
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+
+    amrex::Print() << "Running collective particle IO test \n";
+    testCollectiveIO();
+
+    amrex::Finalize();
+}
@@ -0,0 +1,150 @@
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_Particles.H>
+
+using namespace amrex;
+
+using PC = ParticleContainer<1, 0, 1, 0>;
+
+struct TestParams
+{
+    IntVect size;
+    int max_grid_size;
+    int num_ppc;
+};
+
+void get_test_params (TestParams& params, const std::string& prefix)
+{
+    ParmParse pp(prefix);
+    pp.get("size", params.size);
+    pp.get("max_grid_size", params.max_grid_size);
+    pp.get("num_ppc", params.num_ppc);
+}
+
+// put num_ppc randomly placed particles in every cell of the first quarter
+// of the domain in x, so that the other grids and tiles stay empty
+void InitParticles (PC& pc, int num_ppc)
+{
+    const int lev = 0;
+    const auto dx = pc.Geom(lev).CellSizeArray();
+    const auto plo = pc.Geom(lev).ProbLoArray();
+    const int nx_quarter = pc.Geom(lev).Domain().length(0) / 4;
+
+    for (MFIter mfi = pc.MakeMFIter(lev); mfi.isValid(); ++mfi)
+    {
+        Box tile_box = mfi.tilebox();
+        tile_box.setBig(0, std::min(tile_box.bigEnd(0), nx_quarter-1));
+        if (!tile_box.ok()) continue;
+        const int np = tile_box.numPts() * num_ppc;
+
+        auto& ptile = pc.DefineAndReturnParticleTile(lev, mfi);
+        ptile.resize(np);
+        auto ptd = ptile.getParticleTileData();
+
+        const Long id_start = PC::ParticleType::NextID();
+        PC::ParticleType::NextID(id_start + np);
+        const int cpu = ParallelDescriptor::MyProc();
+
+        amrex::ParallelForRNG(np, [=] AMREX_GPU_DEVICE (int i, RandomEngine const& engine) noexcept
+        {
+            IntVect iv = tile_box.atOffset(i / num_ppc);
+            auto& p = ptd.m_aos[i];
+            for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                p.pos(d) = static_cast<ParticleReal>(plo[d] + (iv[d] + amrex::Random(engine))*dx[d]);
+            }
+            p.id() = id_start + i;
+            p.cpu() = cpu;
+            p.rdata(0) = static_cast<ParticleReal>(p.id());
+            ptd.m_rdata[0][i] = static_cast<ParticleReal>(p.id());
+        });
+    }
+    Gpu::synchronize();
+}
+
+// every tile is in curve order, and the SoA data moved with the particles
+void CheckSorted (PC& pc, ParticleSortCurve curve)
+{
+    const int lev = 0;
+    const Geometry& geom = pc.Geom(lev);
+    const auto& pmap = pc.GetParticles(lev);
+    for (MFIter mfi = pc.MakeMFIter(lev); mfi.isValid(); ++mfi)
+    {
+        auto it = pmap.find(std::make_pair(mfi.index(), mfi.LocalTileIndex()));
+        if (it == pmap.end()) continue;
+        const auto& ptile = it->second;
+        const int np = ptile.numParticles();
+
+        const Box box = mfi.tilebox();
+        Gpu::DeviceVector<unsigned int> order;
+        computeCurveOrder(box.length(), curve, order);
+        GetParticleCurveBin get_bin{geom.ProbLoArray(), geom.InvCellSizeArray(),
+                                    geom.Domain(), box, order.dataPtr()};
+
+        const auto ptd = ptile.getConstParticleTileData();
+        Long nbad = Reduce::Sum<Long>(np, [=] AMREX_GPU_DEVICE (int i) -> Long
+        {
+            const auto& p = ptd.m_aos[i];
+            bool bad = p.rdata(0) != ptd.m_rdata[0][i];
+            if (i+1 < np) bad = bad || get_bin(ptd.m_aos[i+1]) < get_bin(p);
+            return bad;
+        });
+        AMREX_ALWAYS_ASSERT(nbad == 0);
+    }
+}
+
+void testCurveSort ()
+{
+    BL_PROFILE("testCurveSort");
+    TestParams params;
+    get_test_params(params, "sort");
+
+    RealBox real_box;
+    for (int n = 0; n < AMREX_SPACEDIM; n++)
+    {
+        real_box.setLo(n, 0.0);
+        real_box.setHi(n, 1.0);
+    }
+
+    IntVect domain_lo(AMREX_D_DECL(0, 0, 0));
+    IntVect domain_hi(AMREX_D_DECL(params.size[0]-1,params.size[1]-1,params.size[2]-1));
+    const Box domain(domain_lo, domain_hi);
+
+    int coord = 0;
+    int is_per[AMREX_SPACEDIM];
+    for (int i = 0; i < AMREX_SPACEDIM; i++)
+        is_per[i] = 1;
+    Geometry geom(domain, &real_box, coord, is_per);
+
+    BoxArray ba(domain);
+    ba.maxSize(params.max_grid_size);
+    DistributionMapping dm(ba);
+
+    for (auto curve : {ParticleSortCurve::Morton, ParticleSortCurve::Hilbert})
+    {
+        PC pc(geom, dm, ba);
+        InitParticles(pc, params.num_ppc);
+        const Long np_total = pc.TotalNumberOfParticles();
+        AMREX_ALWAYS_ASSERT(np_total == domain.numPts()*params.num_ppc/4);
+
+        // Redistribute removes the empty tiles before it sorts the others
+        pc.setLocalitySort(curve, 0.0);
+        pc.Redistribute();
+
+        AMREX_ALWAYS_ASSERT(pc.TotalNumberOfParticles() == np_total);
+        AMREX_ALWAYS_ASSERT(pc.OK());
+        CheckSorted(pc, curve);
+    }
+
+    amrex::Print() << "pass \n";
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+
+    amrex::Print() << "Running curve sort test \n";
+    testCurveSort();
+
+    amrex::Finalize();
+}
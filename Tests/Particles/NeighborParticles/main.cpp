@@ -183,4 +183,22 @@ void testNeighborList ()
     pc.buildNeighborList(CheckPair());
 
     pc.checkNeighborList();
+
+    amrex::PrintToFile("neighbor_test") << "Testing Verlet neighbor list" << std::endl;
+
+    // each move displaces every particle by 0.3*skin
+    const Real skin = 0.2;
+    const auto step = static_cast<ParticleReal>(0.3*skin/std::sqrt(Real(AMREX_SPACEDIM)));
+
+    AMREX_ALWAYS_ASSERT(pc.updateVerletNeighborList(CheckPair(), skin));
+
+    pc.moveParticles(step);
+    AMREX_ALWAYS_ASSERT(!pc.updateVerletNeighborList(CheckPair(), skin));
+
+    pc.moveParticles(step);
+    AMREX_ALWAYS_ASSERT(pc.updateVerletNeighborList(CheckPair(), skin));
+    pc.checkNeighborList();
+
+    pc.moveParticles(step);
+    AMREX_ALWAYS_ASSERT(!pc.updateVerletNeighborList(CheckPair(), skin));
 }
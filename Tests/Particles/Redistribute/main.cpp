@@ -424,6 +424,29 @@ void testRedistribute ()
             pc.RedistributeGlobal();
             pc.checkAnswer();
         }
+
+        {
+            // pile every grid onto rank 0 and let the particle counts spread them out again
+            const int lev = 0;
+            DistributionMapping new_dm(Vector<int>(ba[lev].size(), 0));
+            pc.SetParticleDistributionMap(lev, new_dm);
+            pc.RedistributeGlobal();
+
+            MultiFab mf(ba[lev], new_dm, 1, 0);
+            for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
+                mf[mfi].setVal<RunOn::Host>(static_cast<Real>(mfi.index()));
+            }
+
+            const bool moved = pc.LoadBalance(lev, {&mf});
+            AMREX_ALWAYS_ASSERT(moved == (NProcs > 1 && ba[lev].size() > 1));
+            AMREX_ALWAYS_ASSERT(mf.DistributionMap() == pc.ParticleDistributionMap(lev));
+            pc.checkAnswer();
+
+            for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
+                AMREX_ALWAYS_ASSERT(mf[mfi].min<RunOn::Host>(0) == static_cast<Real>(mfi.index()) &&
+                                    mf[mfi].max<RunOn::Host>(0) == static_cast<Real>(mfi.index()));
+            }
+        }
     }
 
     if (geom[0].isAllPeriodic()) AMREX_ALWAYS_ASSERT(np_old == pc.TotalNumberOfParticles());
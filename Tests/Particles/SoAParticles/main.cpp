@@ -0,0 +1,248 @@
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_iMultiFab.H>
+#include <AMReX_SoAParticles.H>
+
+using namespace amrex;
+
+static constexpr int NAR = 2;
+static constexpr int NAI = 1;
+
+using SoAPC = SoAParticleContainer<NAR, NAI>;
+using AoSPC = ParticleContainer<0, 0, NAR, NAI>;
+
+struct TestParams
+{
+    IntVect size;
+    int max_grid_size;
+    int num_ppc;
+    int nsteps;
+};
+
+void get_test_params (TestParams& params, const std::string& prefix)
+{
+    ParmParse pp(prefix);
+    pp.get("size", params.size);
+    pp.get("max_grid_size", params.max_grid_size);
+    pp.get("num_ppc", params.num_ppc);
+    pp.get("nsteps", params.nsteps);
+}
+
+void InitParticles (SoAPC& pc, int num_ppc)
+{
+    const int lev = 0;
+    const auto dx = pc.Geom(lev).CellSizeArray();
+    const auto plo = pc.Geom(lev).ProbLoArray();
+
+    for (MFIter mfi = pc.MakeMFIter(lev); mfi.isValid(); ++mfi)
+    {
+        const Box& tile_box = mfi.tilebox();
+        const int np = tile_box.numPts() * num_ppc;
+
+        auto& ptile = pc.DefineAndReturnParticleTile(lev, mfi);
+        ptile.resize(np);
+        auto ptd = ptile.getParticleTileData();
+
+        const Long id_start = SoAPC::ParticleType::NextID();
+        SoAPC::ParticleType::NextID(id_start + np);
+        const int cpu = ParallelDescriptor::MyProc();
+
+        amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE (int i) noexcept
+        {
+            IntVect iv = tile_box.atOffset(i / num_ppc);
+            const int ip = i % num_ppc;
+            for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                ptd.pos(i, d) = static_cast<ParticleReal>(plo[d] + (iv[d] + (ip+0.5)/num_ppc)*dx[d]);
+            }
+            ptd.id(i) = id_start + i;
+            ptd.cpu(i) = cpu;
+            ptd.m_rdata[0][i] = 1.0;
+            ptd.m_rdata[1][i] = 0.0;
+            ptd.m_idata[0][i] = i;
+        });
+    }
+    Gpu::synchronize();
+}
+
+template <class PC>
+void MoveParticles (PC& pc, int step)
+{
+    const int lev = 0;
+    const auto dx = pc.Geom(lev).CellSizeArray();
+    for (auto& kv : pc.GetParticles(lev))
+    {
+        auto& ptile = kv.second;
+        const int np = ptile.numParticles();
+        auto ptd = ptile.getParticleTileData();
+        amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE (int i) noexcept
+        {
+            auto sp = ptd.getSuperParticle(i);
+            const Long id = sp.id();
+            for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                const int k = static_cast<int>((id*7 + d*3 + step) % 5) - 2;
+                sp.pos(d) += static_cast<ParticleReal>(0.45*k*dx[d]);
+            }
+            ptd.setSuperParticle(sp, i);
+        });
+    }
+    Gpu::synchronize();
+}
+
+template <class PC>
+void DepositCount (const PC& pc, iMultiFab& count)
+{
+    const Box domain = pc.Geom(0).Domain();
+    count.setVal(0);
+    amrex::ParticleToMesh(pc, count, 0,
+        [=] AMREX_GPU_DEVICE (const typename PC::SuperParticleType& p,
+                              Array4<int> const& arr,
+                              GpuArray<Real,AMREX_SPACEDIM> const& plo,
+                              GpuArray<Real,AMREX_SPACEDIM> const& dxi)
+        {
+            IntVect iv = getParticleCell(p, plo, dxi, domain);
+            Gpu::Atomic::AddNoRet(&arr(iv), 1);
+        });
+}
+
+void testSoAParticles ()
+{
+    BL_PROFILE("testSoAParticles");
+    TestParams params;
+    get_test_params(params, "soa");
+
+    RealBox real_box;
+    for (int n = 0; n < AMREX_SPACEDIM; n++)
+    {
+        real_box.setLo(n, 0.0);
+        real_box.setHi(n, 1.0);
+    }
+
+    IntVect domain_lo(AMREX_D_DECL(0, 0, 0));
+    IntVect domain_hi(AMREX_D_DECL(params.size[0]-1,params.size[1]-1,params.size[2]-1));
+    const Box domain(domain_lo, domain_hi);
+
+    int coord = 0;
+    int is_per[AMREX_SPACEDIM];
+    for (int i = 0; i < AMREX_SPACEDIM; i++)
+        is_per[i] = 1;
+    Geometry geom(domain, &real_box, coord, is_per);
+
+    BoxArray ba(domain);
+    ba.maxSize(params.max_grid_size);
+    DistributionMapping dm(ba);
+
+    SoAPC soa_pc(geom, dm, ba);
+    InitParticles(soa_pc, params.num_ppc);
+
+    AoSPC aos_pc(geom, dm, ba);
+    aos_pc.addParticles(soa_pc, particle_detail::KeepAllParticles{}, true);
+
+    const Long np_total = soa_pc.TotalNumberOfParticles();
+    AMREX_ALWAYS_ASSERT(np_total == domain.numPts()*params.num_ppc);
+    AMREX_ALWAYS_ASSERT(aos_pc.TotalNumberOfParticles() == np_total);
+
+    for (int step = 0; step < params.nsteps; ++step)
+    {
+        MoveParticles(soa_pc, step);
+        MoveParticles(aos_pc, step);
+        soa_pc.Redistribute();
+        aos_pc.Redistribute();
+    }
+
+    AMREX_ALWAYS_ASSERT(soa_pc.TotalNumberOfParticles() == np_total);
+
+    using SPType = typename SoAPC::SuperParticleType;
+    using APType = typename AoSPC::SuperParticleType;
+    for (int d = 0; d < AMREX_SPACEDIM; ++d)
+    {
+        auto soa_sum = ReduceSum(soa_pc, [=] AMREX_GPU_HOST_DEVICE (const SPType& p) -> Real { return p.pos(d); });
+        auto aos_sum = ReduceSum(aos_pc, [=] AMREX_GPU_HOST_DEVICE (const APType& p) -> Real { return p.pos(d); });
+        ParallelAllReduce::Sum(soa_sum, ParallelContext::CommunicatorSub());
+        ParallelAllReduce::Sum(aos_sum, ParallelContext::CommunicatorSub());
+        AMREX_ALWAYS_ASSERT(std::abs(soa_sum - aos_sum) <= 1.e-9*std::abs(aos_sum));
+    }
+
+    // every particle must sit in the valid box of the grid it is stored in
+    {
+        const auto plo = geom.ProbLoArray();
+        const auto dxi = geom.InvCellSizeArray();
+        for (SoAPC::ParConstIterType pti(soa_pc, 0); pti.isValid(); ++pti)
+        {
+            const Box bx = pti.validbox();
+            const auto ptd = pti.GetParticleTile().getConstParticleTileData();
+            ReduceOps<ReduceOpMin> reduce_op;
+            ReduceData<int> reduce_data(reduce_op);
+            using ReduceTuple = typename decltype(reduce_data)::Type;
+            reduce_op.eval(pti.numParticles(), reduce_data,
+                           [=] AMREX_GPU_DEVICE (int i) -> ReduceTuple
+                           {
+                               return bx.contains(getParticleCell(ptd.getParticle(i), plo, dxi, domain));
+                           });
+            AMREX_ALWAYS_ASSERT(amrex::get<0>(reduce_data.value(reduce_op)) == 1);
+        }
+    }
+
+    // deposition must agree with the AoS container
+    {
+        iMultiFab soa_count(ba, dm, 1, 0);
+        iMultiFab aos_count(ba, dm, 1, 0);
+        DepositCount(soa_pc, soa_count);
+        DepositCount(aos_pc, aos_count);
+        AMREX_ALWAYS_ASSERT(soa_count.sum(0) == np_total);
+        iMultiFab::Subtract(soa_count, aos_count, 0, 0, 1, 0);
+        AMREX_ALWAYS_ASSERT(soa_count.max(0) == 0 && soa_count.min(0) == 0);
+    }
+
+    // gather a constant field onto the particles
+    {
+        MultiFab field(ba, dm, 1, 1);
+        field.setVal(3.0);
+        const Box dom = domain;
+        amrex::MeshToParticle(soa_pc, field, 0,
+            [=] AMREX_GPU_DEVICE (const SoAParticleTileData<NAR, NAI>& ptd, int i,
+                                  Array4<const Real> const& arr,
+                                  GpuArray<Real,AMREX_SPACEDIM> const& plo,
+                                  GpuArray<Real,AMREX_SPACEDIM> const& dxi)
+            {
+                IntVect iv = getParticleCell(ptd.getParticle(i), plo, dxi, dom);
+                ptd.m_rdata[1][i] += static_cast<ParticleReal>(arr(iv));
+            });
+        auto sm = ReduceSum(soa_pc, [=] AMREX_GPU_HOST_DEVICE (const SPType& p) -> Real { return p.rdata(1); });
+        ParallelAllReduce::Sum(sm, ParallelContext::CommunicatorSub());
+        AMREX_ALWAYS_ASSERT(sm == 3.0*np_total);
+    }
+
+    // checkpoint and restart
+    {
+        soa_pc.Checkpoint("soa_chk", "particles");
+
+        SoAPC restart_pc(geom, dm, ba);
+        restart_pc.Restart("soa_chk", "particles");
+        AMREX_ALWAYS_ASSERT(restart_pc.TotalNumberOfParticles() == np_total);
+
+        auto id_sum = [] (const auto& pc) {
+            using PType = typename std::decay_t<decltype(pc)>::SuperParticleType;
+            auto r = ReduceSum(pc, [=] AMREX_GPU_HOST_DEVICE (const PType& p) -> Long { return p.id(); });
+            ParallelAllReduce::Sum(r, ParallelContext::CommunicatorSub());
+            return r;
+        };
+        AMREX_ALWAYS_ASSERT(id_sum(restart_pc) == id_sum(soa_pc));
+
+        auto sm = ReduceSum(restart_pc, [=] AMREX_GPU_HOST_DEVICE (const SPType& p) -> Real { return p.rdata(1); });
+        ParallelAllReduce::Sum(sm, ParallelContext::CommunicatorSub());
+        AMREX_ALWAYS_ASSERT(sm == 3.0*np_total);
+    }
+
+    amrex::Print() << "pass \n";
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+
+    amrex::Print() << "Running pure SoA particle container test \n";
+    testSoAParticles();
+
+    amrex::Finalize();
+}
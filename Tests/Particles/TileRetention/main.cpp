@@ -0,0 +1,192 @@
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_Particles.H>
+
+using namespace amrex;
+
+using PC = ParticleContainer<1, 0, 1, 0, ParticlePoolAllocator>;
+
+struct TestParams
+{
+    IntVect size;
+    int max_grid_size;
+    int num_ppc;
+    int retention_steps;
+};
+
+void get_test_params (TestParams& params, const std::string& prefix)
+{
+    ParmParse pp(prefix);
+    pp.get("size", params.size);
+    pp.get("max_grid_size", params.max_grid_size);
+    pp.get("num_ppc", params.num_ppc);
+    pp.get("retention_steps", params.retention_steps);
+}
+
+// put num_ppc particles in every cell of the lower half of the domain in x
+void InitParticles (PC& pc, int num_ppc)
+{
+    const int lev = 0;
+    const auto dx = pc.Geom(lev).CellSizeArray();
+    const auto plo = pc.Geom(lev).ProbLoArray();
+    const int nx_half = pc.Geom(lev).Domain().length(0) / 2;
+
+    for (MFIter mfi = pc.MakeMFIter(lev); mfi.isValid(); ++mfi)
+    {
+        Box tile_box = mfi.tilebox();
+        tile_box.setBig(0, std::min(tile_box.bigEnd(0), nx_half-1));
+        if (!tile_box.ok()) continue;
+        const int np = tile_box.numPts() * num_ppc;
+
+        auto& ptile = pc.DefineAndReturnParticleTile(lev, mfi);
+        ptile.resize(np);
+        auto ptd = ptile.getParticleTileData();
+
+        const Long id_start = PC::ParticleType::NextID();
+        PC::ParticleType::NextID(id_start + np);
+        const int cpu = ParallelDescriptor::MyProc();
+
+        amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE (int i) noexcept
+        {
+            IntVect iv = tile_box.atOffset(i / num_ppc);
+            const int ip = i % num_ppc;
+            auto& p = ptd.m_aos[i];
+            for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                p.pos(d) = static_cast<ParticleReal>(plo[d] + (iv[d] + (ip+0.5)/num_ppc)*dx[d]);
+            }
+            p.id() = id_start + i;
+            p.cpu() = cpu;
+            p.rdata(0) = 1.0;
+            ptd.m_rdata[0][i] = 2.0;
+        });
+    }
+    Gpu::synchronize();
+}
+
+// shift every particle by half of the domain in x; Redistribute wraps them around
+void ShiftParticles (PC& pc)
+{
+    const Real shift = 0.5*pc.Geom(0).ProbLength(0);
+    for (auto& kv : pc.GetParticles(0))
+    {
+        auto ptd = kv.second.getParticleTileData();
+        amrex::ParallelFor(kv.second.numParticles(), [=] AMREX_GPU_DEVICE (int i) noexcept
+        {
+            ptd.m_aos[i].pos(0) += static_cast<ParticleReal>(shift);
+        });
+    }
+    Gpu::synchronize();
+}
+
+Long GlobalReallocations (const PC& pc)
+{
+    Long r = pc.NumTileReallocations();
+    ParallelAllReduce::Sum(r, ParallelContext::CommunicatorSub());
+    return r;
+}
+
+void testTileRetention ()
+{
+    BL_PROFILE("testTileRetention");
+    TestParams params;
+    get_test_params(params, "retention");
+
+    RealBox real_box;
+    for (int n = 0; n < AMREX_SPACEDIM; n++)
+    {
+        real_box.setLo(n, 0.0);
+        real_box.setHi(n, 1.0);
+    }
+
+    IntVect domain_lo(AMREX_D_DECL(0, 0, 0));
+    IntVect domain_hi(AMREX_D_DECL(params.size[0]-1,params.size[1]-1,params.size[2]-1));
+    const Box domain(domain_lo, domain_hi);
+
+    int coord = 0;
+    int is_per[AMREX_SPACEDIM];
+    for (int i = 0; i < AMREX_SPACEDIM; i++)
+        is_per[i] = 1;
+    Geometry geom(domain, &real_box, coord, is_per);
+
+    BoxArray ba(domain);
+    ba.maxSize(params.max_grid_size);
+    DistributionMapping dm(ba);
+
+    PC pc_keep(geom, dm, ba);
+    pc_keep.setTileRetention(params.retention_steps);
+    InitParticles(pc_keep, params.num_ppc);
+
+    PC pc_free(geom, dm, ba);
+    pc_free.setTileRetention(0);
+    InitParticles(pc_free, params.num_ppc);
+
+    const Long np_total = pc_keep.TotalNumberOfParticles();
+    AMREX_ALWAYS_ASSERT(np_total == domain.numPts()*params.num_ppc/2);
+
+    // the particles hop between the two halves of the domain, so half the
+    // tiles empty out and fill up again on every step
+    Long arena_allocs = 0;
+    const int nsteps = 8;
+    for (int step = 0; step < nsteps; ++step)
+    {
+        ShiftParticles(pc_keep);
+        ShiftParticles(pc_free);
+        pc_keep.Redistribute();
+        pc_free.Redistribute();
+
+        AMREX_ALWAYS_ASSERT(pc_keep.TotalNumberOfParticles() == np_total);
+        AMREX_ALWAYS_ASSERT(pc_free.TotalNumberOfParticles() == np_total);
+
+        if (step >= 2)
+        {
+            // once every tile has been filled, the retained tiles never reallocate ...
+            AMREX_ALWAYS_ASSERT(GlobalReallocations(pc_keep) == 0);
+            // ... while the others free and allocate their storage every time
+            AMREX_ALWAYS_ASSERT(GlobalReallocations(pc_free) > 0);
+        }
+
+        // and the pool serves the churn without going back to the arena
+        const Long allocs = ParticleMemoryPool::stats().arena_allocs;
+        if (step >= 3) AMREX_ALWAYS_ASSERT(allocs == arena_allocs);
+        arena_allocs = allocs;
+    }
+
+    pc_keep.PrintCapacity();
+
+    // when the particles stop moving, the storage of the empty tiles is released after retention_steps
+    Long nreleased = 0;
+    for (int step = 0; step <= params.retention_steps; ++step)
+    {
+        pc_keep.Redistribute();
+        nreleased += GlobalReallocations(pc_keep);
+    }
+    AMREX_ALWAYS_ASSERT(nreleased > 0);
+    for (const auto& kv : pc_keep.GetParticles(0))
+    {
+        AMREX_ALWAYS_ASSERT(kv.second.numParticles() > 0 || kv.second.capacity() == 0);
+    }
+    AMREX_ALWAYS_ASSERT(pc_keep.TotalNumberOfParticles() == np_total);
+
+    // lowering the bound on the cache returns the blocks above it to the arena ...
+    const Long max_cached = ParticleMemoryPool::stats().bytes_cached / 2;
+    ParticleMemoryPool::setMaxCachedBytes(max_cached);
+    AMREX_ALWAYS_ASSERT(ParticleMemoryPool::stats().bytes_cached <= max_cached);
+
+    // ... and once the pool is released, freed blocks are not cached again
+    ParticleMemoryPool::release();
+    pc_free.clearParticles();
+    AMREX_ALWAYS_ASSERT(ParticleMemoryPool::stats().bytes_cached == 0);
+
+    amrex::Print() << "pass \n";
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+
+    amrex::Print() << "Running tile retention test \n";
+    testTileRetention();
+
+    amrex::Finalize();
+}
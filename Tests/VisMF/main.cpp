@@ -0,0 +1,72 @@
+#include <AMReX.H>
+#include <AMReX_FArrayBox.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_Print.H>
+#include <AMReX_VisMF.H>
+
+#include <string>
+
+using namespace amrex;
+
+void testElasticRead (VisMF::Header::Version version, FABio::Format format)
+{
+    Box domain(IntVect(0), IntVect(63));
+    BoxArray ba(domain);
+    ba.maxSize(16);
+
+    // Write as if from a run on a single rank.
+    DistributionMapping dm_write(Vector<int>(ba.size(), 0));
+    const int ncomp = 2;
+    const IntVect ngrow(1);
+
+    MultiFab mf_write(ba, dm_write, ncomp, ngrow);
+    for (MFIter mfi(mf_write); mfi.isValid(); ++mfi) {
+        auto const& a = mf_write.array(mfi);
+        const int gid = mfi.index();
+        amrex::ParallelFor(mfi.fabbox(), ncomp,
+        [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
+        {
+            a(i,j,k,n) = Real(i + 2*j + 3*k + 1000*n + 100000*gid);
+        });
+    }
+
+    VisMF::SetHeaderVersion(version);
+    FArrayBox::setFormat(format);
+    std::string name = "elastic_mf_" + std::to_string(int(version)) + "_" + std::to_string(int(format));
+    VisMF::Write(mf_write, name);
+
+    // Read onto the default DistributionMapping of this run.
+    DistributionMapping dm_read(ba);
+    MultiFab mf_read(ba, dm_read, ncomp, ngrow);
+    mf_read.setVal(-1.0);
+    VisMF::SetUseElasticReads(true);
+    VisMF::Read(mf_read, name);
+    VisMF::SetUseElasticReads(false);
+
+    MultiFab mf_check(ba, dm_read, ncomp, ngrow);
+    mf_check.Redistribute(mf_write, 0, 0, ncomp, ngrow);
+    MultiFab::Subtract(mf_check, mf_read, 0, 0, ncomp, ngrow);
+    Real err = mf_check.norminf(0, ncomp, ngrow);
+
+    amrex::Print() << "  header version " << int(version) << ", format " << int(format)
+                   << ": error = " << err << "\n";
+    if (err != Real(0.0)) {
+        amrex::Abort("VisMF elastic read failed");
+    }
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+
+    amrex::Print() << "Running VisMF elastic read test. \n";
+    for (auto version : {VisMF::Header::Version_v1,
+                         VisMF::Header::NoFabHeader_v1,
+                         VisMF::Header::NoFabHeaderMinMax_v1}) {
+        for (auto format : {FABio::FAB_NATIVE, FABio::FAB_IEEE_32}) {
+            testElasticRead(version, format);
+        }
+    }
+
+    amrex::Finalize();
+}
@@ -1,10 +1,12 @@
 #include <AMReX.H>
 #include <AMReX_Print.H>
 #include <AMReX_PlotFileUtil.H>
+#include <AMReX_ParallelDescriptor.H>
 #include <algorithm>
 #include <limits>
 #include <cmath>
 #include <cstdlib>
+#include <memory>
 
 using namespace amrex;
 
@@ -24,7 +26,7 @@ void PrintUsage()
         << " variable.\n"
         << "\n"
         << " usage:\n"
-        << "    fcompare [-n|--norm num] [-d|--diffvar var] [-z|--zone_info var] [-a|--allow_diff_grids] [-r|rel_tol] [--abs_tol] file1 file2\n"
+        << "    fcompare [-n|--norm num] [-d|--diffvar var] [-z|--zone_info var] [-a|--allow_diff_grids] [-r|rel_tol] [--abs_tol] [-m|--header_minmax] file1 file2\n"
         << "\n"
         << " optional arguments:\n"
         << "    -n|--norm num         : what norm to use (default is 0 for inf norm)\n"
@@ -35,6 +37,16 @@ void PrintUsage()
         << "    -a|--allow_diff_grids : allow different BoxArrays covering the same domain\n"
         << "    -r|--rel_tol rtol     : relative tolerance (default is 0)\n"
         << "    --abs_tol atol        : absolute tolerance (default is 0)\n"
+        << "    -m|--header_minmax    : use the per-FAB min/max stored in the headers to\n"
+        << "                            skip FABs that are provably identical, and (with\n"
+        << "                            the inf norm) to skip variables whose difference\n"
+        << "                            provably exceeds the tolerances.  The error\n"
+        << "                            reported for the latter is a lower bound, and\n"
+        << "                            they are not checked for NaNs.\n"
+        << "\n"
+        << " The data are streamed one FAB at a time, so the memory footprint is\n"
+        << " independent of the plotfile size.  FABs are distributed over MPI ranks\n"
+        << " and processed concurrently by OpenMP threads.\n"
         << std::endl;
 }
 
@@ -60,6 +72,7 @@ int main_main()
     std::string zone_info_var_name;
     Vector<std::string> plot_names(1);
     bool abort_if_not_all_found = false;
+    bool header_minmax = false;
 
     int farg = 1;
     while (farg <= narg) {
@@ -87,6 +100,8 @@ int main_main()
             atol = std::stod(amrex::get_command_argument(++farg));
         } else if (fname == "--abort_if_not_all_found") {
             abort_if_not_all_found = true;
+        } else if (fname == "-m" || fname == "--header_minmax") {
+            header_minmax = true;
         } else {
             break;
         }
@@ -206,71 +221,199 @@ int main_main()
             }
         }
 
+        const BoxArray& ba = pf_a.boxArray(ilev);
+        const DistributionMapping& dmap = pf_a.DistributionMap(ilev);
+        const int nboxes = ba.size();
+        Vector<int> local_gids;
+        for (int i = 0; i < nboxes; ++i) {
+            if (dmap[i] == ParallelDescriptor::MyProc()) {
+                local_gids.push_back(i);
+            }
+        }
+        const int nlocal = local_gids.size();
+
         Vector<Real> aerror(ncomp_a, 0.0);
         Vector<Real> rerror(ncomp_a, 0.0);
         Vector<Real> rerror_denom(ncomp_a, 0.0);
         Vector<int> has_nan_a(ncomp_a, false);
         Vector<int> has_nan_b(ncomp_a, false);
+        Vector<int> lower_bound(ncomp_a, false);
         for (int icomp_a = 0; icomp_a < ncomp_a; ++icomp_a) {
-            if (ivar_b[icomp_a] >= 0) {
-                const MultiFab& mf_a = pf_a.get(ilev, names_a[icomp_a]);
-                MultiFab mf_b;
-                if (grids_match) {
-                    mf_b = pf_b.get(ilev, names_b[ivar_b[icomp_a]]);
-                } else {
-                    mf_b.define(mf_a.boxArray(), mf_a.DistributionMap(), 1, 0);
-                    MultiFab tmp = pf_b.get(ilev, names_b[ivar_b[icomp_a]]);
-                    mf_b.ParallelCopy(tmp);
+            if (ivar_b[icomp_a] < 0) {
+                continue;
+            }
+            const std::string& name_a = names_a[icomp_a];
+            const std::string& name_b = names_b[ivar_b[icomp_a]];
+            const bool need_data = icomp_a == save_var_a || icomp_a == zone_info_var_a;
+
+            // With matching grids, the per-FAB min/max in the headers can
+            // prove a FAB identical, and bound the max norm error from below.
+            Vector<int> identical(nboxes, false);
+            if (header_minmax && grids_match) {
+                bool have_minmax = true;
+                Real lower = 0.0;
+                Real anorm = 0.0;
+                for (int i = 0; i < nboxes && have_minmax; ++i) {
+                    Real amin, amax, bmin, bmax;
+                    have_minmax = pf_a.minMax(ilev, i, name_a, amin, amax)
+                        &&        pf_b.minMax(ilev, i, name_b, bmin, bmax);
+                    if (have_minmax) {
+                        identical[i] = amin == amax && bmin == bmax && amin == bmin;
+                        lower = std::max({lower, std::abs(amax-bmax), std::abs(amin-bmin)});
+                        anorm = std::max({anorm, std::abs(amin), std::abs(amax)});
+                    }
                 }
-                has_nan_a[icomp_a] = mf_a.contains_nan();
-                has_nan_b[icomp_a] = mf_b.contains_nan();
-                MultiFab::Subtract(mf_b,mf_a,0,0,1,0); // b = b - a
-                Real max_err = mf_b.norm0();
-                if (norm == 1) {
-                    aerror[icomp_a] = mf_b.norm1();
-                    rerror[icomp_a] = aerror[icomp_a];
-                    rerror_denom[icomp_a] = mf_a.norm1();
-                } else if (norm == 2) {
-                    aerror[icomp_a] = mf_b.norm2();
-                    rerror[icomp_a] = aerror[icomp_a];
-                    rerror_denom[icomp_a] = mf_a.norm2();
-                } else {
-                    aerror[icomp_a] = max_err;
-                    rerror[icomp_a] = aerror[icomp_a];
-                    rerror_denom[icomp_a] = mf_a.norm0();
+                if (!have_minmax) {
+                    identical.assign(nboxes, false);
+                } else if (norm == 0 && !need_data && lower > atol && lower > rtol*anorm) {
+                    aerror[icomp_a] = lower;
+                    rerror_denom[icomp_a] = anorm;
+                    rerror[icomp_a] = lower / anorm;
+                    lower_bound[icomp_a] = true;
+                    continue;
                 }
+            }
+
+            // Without matching grids, B is read onto A's layout.  Only the
+            // FABs of B intersecting the local boxes of A are read.
+            MultiFab mf_b;
+            if (!grids_match) {
+                mf_b = pf_b.get(ilev, {name_b}, ba, dmap);
+            }
 
-                if (norm == 0) {
-                    rerror[icomp_a] /= rerror_denom[icomp_a];
-                } else {
-                    const auto& dx = pf_a.cellSize(ilev);
-                    Real dv = 1.0;
-                    for (int idim = 0; idim < dm; ++idim) {
-                        dv *= dx[idim];
+            // max_err and max_ref are only used by the inf norm, sum_err and
+            // sum_ref by the 1- and 2-norms.
+            Real max_err = 0.0, max_ref = 0.0;
+            Real sum_err = 0.0, sum_ref = 0.0;
+            int nan_a = false, nan_b = false;
+            Real zone_err = std::numeric_limits<Real>::lowest();
+            int zone_gid = -1;
+            IntVect zone_cell;
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel for schedule(dynamic) reduction(max:max_err,max_ref,nan_a,nan_b) reduction(+:sum_err,sum_ref)
+#endif
+            for (int li = 0; li < nlocal; ++li) {
+                const int gid = local_gids[li];
+                const Box& bx = ba[gid];
+
+                if (identical[gid]) {
+                    Real amin, amax;
+                    pf_a.minMax(ilev, gid, name_a, amin, amax);
+                    const Real npts = static_cast<Real>(bx.numPts());
+                    max_ref = std::max(max_ref, std::abs(amin));
+                    sum_ref += (norm == 2) ? amin*amin*npts : std::abs(amin)*npts;
+                    if (icomp_a == save_var_a) {
+                        mf_array[ilev][gid].setVal<RunOn::Host>(0.0);
                     }
-                    aerror[icomp_a] *= std::pow(dv,1./static_cast<Real>(norm));
-                    rerror[icomp_a] = rerror[icomp_a]/rerror_denom[icomp_a];
+                    continue;
                 }
 
-                if (icomp_a == save_var_a || icomp_a == zone_info_var_a) {
-                    mf_b.abs(0,1);
+                std::unique_ptr<FArrayBox> fab_a, fab_b;
+#ifdef AMREX_USE_OMP
+#pragma omp critical (fcompare_read)
+#endif
+                {
+                    fab_a = std::make_unique<FArrayBox>(pf_a.getFab(ilev, gid, name_a));
+                    if (grids_match) {
+                        fab_b = std::make_unique<FArrayBox>(pf_b.getFab(ilev, gid, name_b));
+                    }
                 }
+                const FArrayBox& src_b = grids_match ? *fab_b : mf_b[gid];
 
+                if (fab_a->contains_nan<RunOn::Host>()) { nan_a = true; }
+                if (src_b.contains_nan<RunOn::Host>()) { nan_b = true; }
+
+                const auto& a = fab_a->const_array();
+                const auto& b = src_b.const_array();
+                Array4<Real> diff;
                 if (icomp_a == save_var_a) {
-                    MultiFab::Copy(mf_array[ilev], mf_b, 0, 0, 1, 0);
+                    diff = mf_array[ilev].array(gid);
                 }
 
+                Real fab_max_err = 0.0;
+                IntVect fab_max_cell = bx.smallEnd();
+                amrex::LoopOnCpu(bx, [&] (int i, int j, int k) noexcept
+                {
+                    const Real d = std::abs(b(i,j,k) - a(i,j,k));
+                    const Real r = std::abs(a(i,j,k));
+                    if (d > fab_max_err) {
+                        fab_max_err = d;
+                        fab_max_cell = IntVect(AMREX_D_DECL(i,j,k));
+                    }
+                    max_ref = std::max(max_ref, r);
+                    if (norm == 1) {
+                        sum_err += d;
+                        sum_ref += r;
+                    } else if (norm == 2) {
+                        sum_err += d*d;
+                        sum_ref += r*r;
+                    }
+                    if (diff) {
+                        diff(i,j,k) = d;
+                    }
+                });
+                max_err = std::max(max_err, fab_max_err);
+
                 if (icomp_a == zone_info_var_a) {
-                    if (max_err > err_zone.max_abs_err) {
-                        err_zone.max_abs_err = max_err;
-                        err_zone.level = ilev;
-                        err_zone.cell = mf_b.maxIndex(0);
-                        auto isects = pf_a.boxArray(ilev).intersections
-                            (Box(err_zone.cell,err_zone.cell), true, 0);
-                        err_zone.grid_index = isects[0].first;
+#ifdef AMREX_USE_OMP
+#pragma omp critical (fcompare_zone)
+#endif
+                    if (fab_max_err > zone_err || (fab_max_err == zone_err && gid < zone_gid)) {
+                        zone_err = fab_max_err;
+                        zone_gid = gid;
+                        zone_cell = fab_max_cell;
                     }
                 }
             }
+
+            Real rmax[2] = {max_err, max_ref};
+            Real rsum[2] = {sum_err, sum_ref};
+            int inan[2] = {nan_a, nan_b};
+            ParallelDescriptor::ReduceRealMax(rmax, 2);
+            ParallelDescriptor::ReduceRealSum(rsum, 2);
+            ParallelDescriptor::ReduceIntMax(inan, 2);
+            max_err = rmax[0];
+            has_nan_a[icomp_a] = inan[0];
+            has_nan_b[icomp_a] = inan[1];
+
+            if (norm == 1) {
+                aerror[icomp_a] = rsum[0];
+                rerror_denom[icomp_a] = rsum[1];
+            } else if (norm == 2) {
+                aerror[icomp_a] = std::sqrt(rsum[0]);
+                rerror_denom[icomp_a] = std::sqrt(rsum[1]);
+            } else {
+                aerror[icomp_a] = max_err;
+                rerror_denom[icomp_a] = rmax[1];
+            }
+            rerror[icomp_a] = aerror[icomp_a];
+
+            if (norm == 0) {
+                rerror[icomp_a] /= rerror_denom[icomp_a];
+            } else {
+                const auto& dx = pf_a.cellSize(ilev);
+                Real dv = 1.0;
+                for (int idim = 0; idim < dm; ++idim) {
+                    dv *= dx[idim];
+                }
+                aerror[icomp_a] *= std::pow(dv,1./static_cast<Real>(norm));
+                rerror[icomp_a] = rerror[icomp_a]/rerror_denom[icomp_a];
+            }
+
+            if (icomp_a == zone_info_var_a && max_err > err_zone.max_abs_err) {
+                // the lowest grid holding the maximum error reports its location
+                int gid = (zone_gid >= 0 && zone_err == max_err) ? zone_gid : nboxes;
+                ParallelDescriptor::ReduceIntMin(gid);
+                if (gid < nboxes) {
+                    Array<int,AMREX_SPACEDIM> cell{{AMREX_D_DECL(zone_cell[0],zone_cell[1],zone_cell[2])}};
+                    ParallelDescriptor::Bcast(cell.data(), cell.size(), dmap[gid]);
+                    err_zone.max_abs_err = max_err;
+                    err_zone.level = ilev;
+                    err_zone.cell = IntVect(AMREX_D_DECL(cell[0],cell[1],cell[2]));
+                    err_zone.grid_index = gid;
+                }
+            }
         }
 
         amrex::Print() << " level = " << ilev << "\n";
@@ -307,6 +450,7 @@ int main_main()
                                << std::right
                                << "  " << std::setw(24) << std::setprecision(10) << aerr
                                << "  " << std::setw(24) << std::setprecision(10) << rerr
+                               << (lower_bound[icomp_a] ? "  (lower bound from headers)" : "")
                                << "\n";
             }
         }
@@ -351,10 +495,11 @@ int main_main()
                                   << "   level = " << err_zone.level << " (i,j,k) = " << err_zone.cell << "\n";
             }
 
-            for (int icomp_a = 0; icomp_a < ncomp_a; ++icomp_a) {
-                const MultiFab& mf = pf_a.get(err_zone.level,names_a[icomp_a]);
-                if (owner_proc) {
-                    Real v = mf[err_zone.grid_index](err_zone.cell);
+            if (owner_proc) {
+                for (int icomp_a = 0; icomp_a < ncomp_a; ++icomp_a) {
+                    const FArrayBox& fab = pf_a.getFab(err_zone.level, err_zone.grid_index,
+                                                       names_a[icomp_a]);
+                    Real v = fab(err_zone.cell);
                     amrex::AllPrint() << " " << std::setw(24)
                                       << names_a[icomp_a] << "  "
                                       << std::setw(24) << std::right
@@ -8,6 +8,7 @@
 #include <cstdlib>
 #include <numeric>
 #include <iterator>
+#include <memory>
 
 using namespace amrex;
 
@@ -59,45 +60,78 @@ void main_main()
         }
 
         // get the extrema
-        Vector<Real> vvmin(var_names.size());
-        Vector<Real> vvmax(var_names.size());
+        Vector<Real> vvmin(var_names.size(), std::numeric_limits<Real>::max());
+        Vector<Real> vvmax(var_names.size(), std::numeric_limits<Real>::lowest());
 
         const int dim = pf.spaceDim();
+        const int nvars = var_names.size();
 
+        // Stream through the plotfile one FAB at a time.  FABs not covered
+        // by the next finer level use the min/max stored in the header if
+        // it has them, and are not read at all.
         for (int ilev = pf.finestLevel(); ilev >= 0; --ilev) {
-            if (ilev == pf.finestLevel()) {
-                for (int ivar = 0; ivar < var_names.size(); ++ivar) {
-                    const MultiFab& mf = pf.get(ilev, var_names[ivar]);
-                    vvmin[ivar] = mf.min(0,0,false);
-                    vvmax[ivar] = mf.max(0,0,false);
-                }
-            } else {
+            const BoxArray& ba = pf.boxArray(ilev);
+            const DistributionMapping& dmap = pf.DistributionMap(ilev);
+
+            iMultiFab mask;
+            BoxArray cfba;
+            if (ilev < pf.finestLevel()) {
                 IntVect ratio{pf.refRatio(ilev)};
                 for (int idim = dim; idim < AMREX_SPACEDIM; ++idim) {
                     ratio[idim] = 1;
                 }
-                iMultiFab mask = makeFineMask(pf.boxArray(ilev), pf.DistributionMap(ilev),
-                                              pf.boxArray(ilev+1), ratio);
-                for (int ivar = 0; ivar < var_names.size(); ++ivar) {
-                    const MultiFab& mf = pf.get(ilev, var_names[ivar]);
-                    for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
-                        const Box& bx = mfi.validbox();
-                        const auto lo = amrex::lbound(bx);
-                        const auto hi = amrex::ubound(bx);
-                        const auto& ifab = mask.array(mfi);
-                        const auto& fab = mf.array(mfi);
-                        for         (int k = lo.z; k <= hi.z; ++k) {
-                            for     (int j = lo.y; j <= hi.y; ++j) {
-                                for (int i = lo.x; i <= hi.x; ++i) {
-                                    if (ifab(i,j,k) == 0) {
-                                        vvmin[ivar] = std::min(fab(i,j,k),vvmin[ivar]);
-                                        vvmax[ivar] = std::max(fab(i,j,k),vvmax[ivar]);
-                                    }
-                                }
-                            }
-                        }
+                mask = makeFineMask(ba, dmap, pf.boxArray(ilev+1), ratio);
+                cfba = amrex::coarsen(pf.boxArray(ilev+1), ratio);
+            }
+
+            Vector<int> local_gids;
+            for (int i = 0, N = ba.size(); i < N; ++i) {
+                if (dmap[i] == ParallelDescriptor::MyProc()) {
+                    local_gids.push_back(i);
+                }
+            }
+            const int nlocal = local_gids.size();
+
+            for (int ivar = 0; ivar < nvars; ++ivar) {
+                Real vmin = vvmin[ivar];
+                Real vmax = vvmax[ivar];
+#ifdef AMREX_USE_OMP
+#pragma omp parallel for schedule(dynamic) reduction(min:vmin) reduction(max:vmax)
+#endif
+                for (int li = 0; li < nlocal; ++li) {
+                    const int gid = local_gids[li];
+                    const Box& bx = ba[gid];
+                    const bool covered = !cfba.empty() && cfba.intersects(bx);
+
+                    Real fmin, fmax;
+                    if (!covered && pf.minMax(ilev, gid, var_names[ivar], fmin, fmax)) {
+                        vmin = std::min(vmin, fmin);
+                        vmax = std::max(vmax, fmax);
+                        continue;
                     }
+
+                    std::unique_ptr<FArrayBox> fab;
+#ifdef AMREX_USE_OMP
+#pragma omp critical (fextrema_read)
+#endif
+                    {
+                        fab = std::make_unique<FArrayBox>(pf.getFab(ilev, gid, var_names[ivar]));
+                    }
+                    const auto& a = fab->const_array();
+                    Array4<int const> m;
+                    if (covered) {
+                        m = mask.const_array(gid);
+                    }
+                    amrex::LoopOnCpu(bx, [&] (int i, int j, int k) noexcept
+                    {
+                        if (!m || m(i,j,k) == 0) {
+                            vmin = std::min(a(i,j,k), vmin);
+                            vmax = std::max(a(i,j,k), vmax);
+                        }
+                    });
                 }
+                vvmin[ivar] = vmin;
+                vvmax[ivar] = vmax;
             }
         }
 
@@ -2,6 +2,8 @@
 #include <AMReX_Print.H>
 #include <AMReX_PlotFileUtil.H>
 #include <algorithm>
+#include <cmath>
+#include <memory>
 
 using namespace amrex;
 
@@ -35,8 +37,44 @@ void main_main()
         const std::string& varname = names[n];
         Vector<int> has_nan(nlevels);
         for (int ilev = 0; ilev < nlevels; ++ilev) {
-            const MultiFab& mf = plotfile.get(ilev,varname);
-            has_nan[ilev] = mf.contains_nan(0,1,0);
+            // Stream through the level one FAB at a time and stop at the
+            // first NaN.  A NaN extremum in the header needs no data read.
+            const BoxArray& ba = plotfile.boxArray(ilev);
+            const DistributionMapping& dmap = plotfile.DistributionMap(ilev);
+            Vector<int> local_gids;
+            for (int i = 0, N = ba.size(); i < N; ++i) {
+                if (dmap[i] == ParallelDescriptor::MyProc()) {
+                    local_gids.push_back(i);
+                }
+            }
+            const int nlocal = local_gids.size();
+
+            int found = false;
+#ifdef AMREX_USE_OMP
+#pragma omp parallel for schedule(dynamic) reduction(max:found)
+#endif
+            for (int li = 0; li < nlocal; ++li) {
+                if (found) { continue; }
+                const int gid = local_gids[li];
+                Real vmin, vmax;
+                if (plotfile.minMax(ilev, gid, varname, vmin, vmax) &&
+                    (std::isnan(vmin) || std::isnan(vmax))) {
+                    found = true;
+                    continue;
+                }
+                std::unique_ptr<FArrayBox> fab;
+#ifdef AMREX_USE_OMP
+#pragma omp critical (fnan_read)
+#endif
+                {
+                    fab = std::make_unique<FArrayBox>(plotfile.getFab(ilev, gid, varname));
+                }
+                if (fab->contains_nan<RunOn::Host>(ba[gid], 0, 1)) {
+                    found = true;
+                }
+            }
+            ParallelDescriptor::ReduceIntMax(found);
+            has_nan[ilev] = found;
         }
 
         int num_nans = 0;